@@ -0,0 +1,280 @@
+#include "Boot/Boot.h"
+#include "Log/Log.h"
+#include "Sdl/Loop/Sdl3Runner.h"
+#include "Sdl/Render/PrimitiveBatch.h"
+#include "Sdl/Render/SpriteBatch.h"
+#include "Sdl/Render/TextureAtlas.h"
+#include "Sdl/RendererScopes.h"
+#include "Sdl/Stats/FrameStats.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr int DefaultShapeCount = 10'000;
+    constexpr float DebugTextScale = 2.0f;
+    constexpr float DebugTextLineHeight = 8.0f;
+    constexpr int SpriteImageCount = 64;
+
+    enum class Mode : uint8_t
+    {
+        PerCall, // SDL_SetRenderDrawColor + SDL_RenderFillRect per shape
+        Batched, // PrimitiveBatch: one SDL_RenderGeometry per flush
+        SpritesPerTexture, // texture per sprite image, SDL_RenderTexture per shape
+        SpritesAtlas, // sprite images packed in TextureAtlas, drawn via SpriteBatch
+        Count,
+    };
+
+    const char* ToString(Mode mode)
+    {
+        switch (mode) {
+            case Mode::PerCall: return "per-call";
+            case Mode::Batched: return "batched";
+            case Mode::SpritesPerTexture: return "sprites per-texture";
+            case Mode::SpritesAtlas: return "sprites atlas";
+            default: return "?";
+        }
+    }
+
+    /// Soft-edged disc of the given color (sprite image stand-in)
+    Sdl::Surface CreateDiscSurface(int size, SDL_Color color)
+    {
+        Sdl::Surface surface{SDL_CreateSurface(size, size, Sdl::Render::TextureAtlas::PageFormat)};
+        if (!surface) {
+            return surface;
+        }
+        const auto radius = static_cast<float>(size) * 0.5f;
+        for (int y = 0; y < size; ++y) {
+            auto* row = reinterpret_cast<Uint8*>(surface->pixels) + static_cast<ptrdiff_t>(y) * surface->pitch;
+            for (int x = 0; x < size; ++x) {
+                const auto dx = static_cast<float>(x) + 0.5f - radius;
+                const auto dy = static_cast<float>(y) + 0.5f - radius;
+                const auto edge = std::clamp(radius - std::sqrt(dx * dx + dy * dy), 0.0f, 1.0f);
+                auto* pixel = row + static_cast<ptrdiff_t>(x) * 4; // RGBA32 byte order
+                pixel[0] = color.r;
+                pixel[1] = color.g;
+                pixel[2] = color.b;
+                pixel[3] = static_cast<Uint8>(edge * 255.0f);
+            }
+        }
+        return surface;
+    }
+
+    struct Shape
+    {
+        SDL_FPoint origin;
+        float phase;
+        float size;
+        SDL_Color color;
+    };
+}
+
+struct BatchHandler
+    : RunLoop::Handler
+    , Sdl::Loop::Sdl3Handler
+{
+    std::vector<Shape> shapes;
+    Mode mode;
+    Sdl::Stats::FrameStats frameStats{300};
+    std::optional<Sdl::Render::PrimitiveBatch> batch;
+
+    std::vector<Sdl::Texture> spriteTextures; // per-texture mode
+    std::optional<Sdl::Render::TextureAtlas> atlas;
+    std::vector<Sdl::Render::TextureAtlas::Sprite> sprites;
+    std::optional<Sdl::Render::SpriteBatch> spriteBatch;
+
+    BatchHandler(int shapeCount, Mode mode)
+        : mode(mode)
+    {
+        std::minstd_rand random{42}; // same scene every run
+        std::uniform_real_distribution<float> unit{0.0f, 1.0f};
+        shapes.resize(static_cast<size_t>(shapeCount));
+        for (auto& shape : shapes) {
+            shape = {
+                .origin = {unit(random) * 1280.0f, unit(random) * 720.0f},
+                .phase = unit(random) * 6.28f,
+                .size = 2.0f + unit(random) * 6.0f,
+                .color = {
+                    static_cast<Uint8>(unit(random) * 255),
+                    static_cast<Uint8>(unit(random) * 255),
+                    static_cast<Uint8>(unit(random) * 255),
+                    255,
+                },
+            };
+        }
+    }
+
+    bool Start() override
+    {
+        Log::Info("{} shapes, mode {} (press B to switch)", shapes.size(), ToString(mode));
+        return true;
+    }
+
+    void Stop() override
+    {
+        Log::Info("{} shapes {}: avg {:.2f} ms p50 {:.2f} ms p99 {:.2f} ms max {:.2f} ms",
+            shapes.size(),
+            ToString(mode),
+            frameStats.GetAverageSeconds() * 1000.0f,
+            frameStats.GetPercentileSeconds(0.50f) * 1000.0f,
+            frameStats.GetPercentileSeconds(0.99f) * 1000.0f,
+            frameStats.GetMaxSeconds() * 1000.0f);
+        if (atlas) {
+            const auto stats = atlas->GetStats();
+            Log::Info("atlas: {} pages, {} sprites, occupancy {:.1f}%", atlas->GetPageCount(), stats.sprites, stats.occupancy * 100.0f);
+        }
+        batch.reset();
+        spriteBatch.reset();
+        sprites.clear();
+        atlas.reset();
+        spriteTextures.clear();
+    }
+
+    void Update(const RunLoop::UpdateCtx& ctx) override
+    {
+        auto& runner = static_cast<Sdl::Loop::Sdl3Runner&>(ctx.Runner);
+        auto* renderer = runner.GetRenderer();
+        auto& renderState = runner.GetRenderState();
+        if (!batch) {
+            batch.emplace(renderState, Sdl::Render::PrimitiveBatch::DefaultMaxVertices);
+            spriteBatch.emplace(renderState);
+            CreateSprites(renderer);
+        }
+        frameStats.AddFrame(ctx.frame.deltaSeconds);
+
+        renderState.SetDrawColor(20, 20, 30);
+        SDL_RenderClear(renderer);
+
+        const auto time = static_cast<float>(ctx.session.passedSeconds);
+        const auto drawCallsBefore = batch->GetStats().drawCalls + spriteBatch->GetStats().drawCalls;
+        switch (mode) {
+            case Mode::PerCall:
+                for (const auto& shape : shapes) {
+                    renderState.SetDrawColor(shape.color);
+                    const auto rect = ShapeRect(shape, time);
+                    SDL_RenderFillRect(renderer, &rect);
+                }
+                break;
+            case Mode::Batched:
+                for (const auto& shape : shapes) {
+                    batch->AddRect(ShapeRect(shape, time), shape.color);
+                }
+                batch->Flush();
+                break;
+            case Mode::SpritesPerTexture:
+                for (size_t index = 0; index < shapes.size() && !spriteTextures.empty(); ++index) {
+                    const auto rect = SpriteRect(shapes[index], time);
+                    SDL_RenderTexture(renderer, spriteTextures[index % spriteTextures.size()].get(), nullptr, &rect);
+                }
+                break;
+            case Mode::SpritesAtlas:
+                for (size_t index = 0; index < shapes.size() && !sprites.empty(); ++index) {
+                    spriteBatch->Draw(sprites[index % sprites.size()], SpriteRect(shapes[index], time));
+                }
+                spriteBatch->Flush();
+                break;
+            default:
+                break;
+        }
+        const auto drawCalls = (mode == Mode::PerCall || mode == Mode::SpritesPerTexture)
+            ? shapes.size()
+            : batch->GetStats().drawCalls + spriteBatch->GetStats().drawCalls - drawCallsBefore;
+
+        Sdl::SetRenderScaleScope scaleScope{renderState, DebugTextScale, DebugTextScale};
+        renderState.SetDrawColor(255, 255, 0);
+        SDL_RenderDebugTextFormat(renderer, 4, 4, "%zu shapes, %s (B - switch): %zu draws", shapes.size(), ToString(mode), drawCalls);
+        SDL_RenderDebugTextFormat(renderer, 4, 4 + DebugTextLineHeight, "avg %.2f ms (%.1f FPS) p99 %.2f ms",
+            frameStats.GetAverageSeconds() * 1000.0f,
+            frameStats.GetAverageFps(),
+            frameStats.GetPercentileSeconds(0.99f) * 1000.0f);
+    }
+
+    SDL_AppResult Sdl3Event(Sdl::Loop::Sdl3Runner& runner, const SDL_Event& event) override
+    {
+        if (event.type == SDL_EVENT_QUIT) {
+            return SDL_APP_SUCCESS;
+        }
+        if (event.type == SDL_EVENT_KEY_DOWN) {
+            if (event.key.key == SDLK_ESCAPE) {
+                return SDL_APP_SUCCESS;
+            }
+            if (event.key.key == SDLK_B) {
+                mode = static_cast<Mode>((static_cast<int>(mode) + 1) % static_cast<int>(Mode::Count));
+                frameStats.Reset();
+                Log::Info("mode {}", ToString(mode));
+            }
+        }
+        return SDL_APP_CONTINUE;
+    }
+
+private:
+    static SDL_FRect ShapeRect(const Shape& shape, float time)
+    {
+        const auto x = shape.origin.x + 20.0f * std::cos(time + shape.phase);
+        const auto y = shape.origin.y + 20.0f * std::sin(time * 1.3f + shape.phase);
+        return {x, y, shape.size, shape.size};
+    }
+
+    static SDL_FRect SpriteRect(const Shape& shape, float time)
+    {
+        auto rect = ShapeRect(shape, time);
+        rect.w = rect.h = shape.size * 2.0f; // sprites are shown larger to see the images
+        return rect;
+    }
+
+    /// Same images both as separate textures and packed into the atlas
+    void CreateSprites(SDL_Renderer* renderer)
+    {
+        std::minstd_rand random{7};
+        std::uniform_int_distribution<int> size{8, 48};
+        std::uniform_int_distribution<int> channel{64, 255};
+        atlas.emplace(renderer);
+        for (int index = 0; index < SpriteImageCount; ++index) {
+            const SDL_Color color{
+                static_cast<Uint8>(channel(random)),
+                static_cast<Uint8>(channel(random)),
+                static_cast<Uint8>(channel(random)),
+                255,
+            };
+            auto surface = CreateDiscSurface(size(random), color);
+            if (!surface) {
+                Log::Error("SDL_CreateSurface failed: {}", SDL_GetError());
+                continue;
+            }
+            if (Sdl::Texture texture{SDL_CreateTextureFromSurface(renderer, surface.get())}) {
+                spriteTextures.push_back(std::move(texture));
+            }
+            if (auto sprite = atlas->Add(surface.get())) {
+                sprites.push_back(*sprite);
+            }
+        }
+        for (size_t page = 0; page < atlas->GetPageCount(); ++page) {
+            const auto stats = atlas->GetPageStats(page);
+            Log::Info("atlas page #{}: {} sprites, occupancy {:.1f}%", page, stats.sprites, stats.occupancy * 100.0f);
+        }
+    }
+};
+
+int main(const int argc, const char* argv[])
+{
+    auto args = Boot::DefaultInit(argc, argv);
+    auto shapeCount = std::max(args.GetIntArg(1).value_or(DefaultShapeCount), 1);
+    auto mode = static_cast<Mode>(std::clamp(args.GetIntArg(2).value_or(1), 0, static_cast<int>(Mode::Count) - 1));
+
+    auto handler = std::make_shared<BatchHandler>(shapeCount, mode);
+    auto runner = std::make_shared<Sdl::Loop::Sdl3Runner>(
+        handler,
+        handler,
+        Sdl::Loop::Sdl3Runner::Options{
+            .Window = {
+                .Title = "Primitive Batch",
+                .Width = 1280,
+                .Height = 720,
+            },
+            .VSync = 0, // measure uncapped frame time
+        }
+    );
+    return runner->Run();
+}
@@ -4,6 +4,8 @@
 #include "Im/Deputy.h"
 #include "Log/Log.h"
 #include "Sdl/Loop/Sdl3Runner.h"
+#include "Sdl/Render/TiledLayer.h"
+#include "Sdl/Stats/StartupTrace.h"
 
 #include "imgui_internal.h"
 
@@ -13,6 +15,7 @@ struct ImHandler
 {
     std::shared_ptr<Im::Deputy> _imDeputy;
     std::unique_ptr<Im::QuakeConsole> _console;
+    std::unique_ptr<Sdl::Render::TiledLayer> _background;
     bool _show_demo_window = true;
 
     bool Start() override
@@ -23,11 +26,16 @@ struct ImHandler
             .window=sdlRunner.GetWindow(),
             .renderer=sdlRunner.GetRenderer(),
             .drive=Fs::System::MakeDefaultDrive(),
+            .renderState=&sdlRunner.GetRenderState(),
         });
         
         // Initialize Quake-style console (visible by default)
         _console = std::make_unique<Im::QuakeConsole>(true);
         _console->Initialize();
+
+        // Static background drawn once into cached tiles, only composited per frame
+        _background = std::make_unique<Sdl::Render::TiledLayer>(sdlRunner.GetRenderState(), sdlRunner.GetTexturePool(), 520, 420);
+        _background->SetContent(DrawBackground);
         
         return true;
     }
@@ -37,23 +45,23 @@ struct ImHandler
         Log::Info("SDL3 Runner quitting");
         _console.reset();
         _imDeputy.reset();
+        _background.reset();
     }
 
     void Update(const RunLoop::UpdateCtx& ctx) override
     {
         auto& sdlRunner = static_cast<Sdl::Loop::Sdl3Runner&>(ctx.Runner);
         auto* renderer = sdlRunner.GetRenderer();
+        auto& renderState = sdlRunner.GetRenderState();
         auto elapsed = ctx.session.passedSeconds;
 
         // Clear with dark blue
         //SDL_SetRenderScale(renderer, 1, 1);
-        SDL_SetRenderDrawColor(renderer, 30, 30, 130, 255);
+        renderState.SetDrawColor(30, 30, 130);
         SDL_RenderClear(renderer);
 
-        // Static rectangle 500x400 from top-left corner towards center
-        SDL_SetRenderDrawColor(renderer, 55, 100, 100, 255);
-        SDL_FRect staticRect = {10, 10, 500, 400};
-        SDL_RenderFillRect(renderer, &staticRect);
+        // Static rectangle 500x400 from top-left corner towards center (cached)
+        _background->Render({0, 0});
 
         // Animated rectangle - moves in circle and pulses
         float centerX = 320.0f;
@@ -67,14 +75,14 @@ struct ImHandler
         auto r = static_cast<Uint8>(200 + 55 * std::sinf(elapsed * 3.0f));
         auto g = static_cast<Uint8>(80 + 40 * std::sinf(elapsed * 2.0f));
 
-        SDL_SetRenderDrawColor(renderer, r, g, 50, 255);
+        renderState.SetDrawColor(r, g, 50);
         SDL_FRect rect = {x - size / 2, y - size / 2, size, size};
         SDL_RenderFillRect(renderer, &rect);
 
         // Second rectangle rotating opposite direction
         float x2 = centerX + radius * std::cosf(-elapsed * 1.5f);
         float y2 = centerY + radius * std::sinf(-elapsed * 1.5f);
-        SDL_SetRenderDrawColor(renderer, 100, 200, 100, 255);
+        renderState.SetDrawColor(100, 200, 100);
         SDL_FRect rect2 = {x2 - 25, y2 - 25, 50, 50};
         SDL_RenderFillRect(renderer, &rect2);
 
@@ -93,6 +101,17 @@ struct ImHandler
 
                 auto framerate = _imDeputy->GetImGuiIO().Framerate;
                 ImGui::Text("ImGUI FPS: %.3f ms/frame (%.1f FPS)", 1000.0f / framerate, framerate);
+                const auto& allocations = sdlRunner.GetFrameAllocations();
+                ImGui::Text("Allocs/frame: %llu (%llu bytes)",
+                    static_cast<unsigned long long>(allocations.allocations),
+                    static_cast<unsigned long long>(allocations.bytes));
+                if (const auto* poolStats = _imDeputy->GetAllocatorStats()) {
+                    ImGui::Text("ImGui pool: %zu KiB live (peak %zu), %zu KiB slabs, %llu large",
+                        poolStats->liveBytes / 1024,
+                        poolStats->peakLiveBytes / 1024,
+                        poolStats->slabBytes / 1024,
+                        static_cast<unsigned long long>(poolStats->largeAllocations));
+                }
             }
             ImGui::End();
 
@@ -129,6 +148,26 @@ struct ImHandler
         _imDeputy->UpdateEnd();
     }
 
+    static void DrawBackground(Sdl::RenderState& renderState, SDL_Point origin, const SDL_Rect& /*area*/)
+    {
+        auto* renderer = renderState.GetRenderer();
+        const auto offsetX = static_cast<float>(origin.x);
+        const auto offsetY = static_cast<float>(origin.y);
+
+        renderState.SetDrawColor(55, 100, 100);
+        SDL_FRect staticRect = {10 - offsetX, 10 - offsetY, 500, 400};
+        SDL_RenderFillRect(renderer, &staticRect);
+
+        // 20px grid
+        renderState.SetDrawColor(70, 120, 120);
+        for (float x = 30.0f; x < 510.0f; x += 20.0f) {
+            SDL_RenderLine(renderer, x - offsetX, 10 - offsetY, x - offsetX, 410 - offsetY);
+        }
+        for (float y = 30.0f; y < 410.0f; y += 20.0f) {
+            SDL_RenderLine(renderer, 10 - offsetX, y - offsetY, 510 - offsetX, y - offsetY);
+        }
+    }
+
     SDL_AppResult Sdl3Event(Sdl::Loop::Sdl3Runner& runner, const SDL_Event& event) override
     {
         // Handle console toggle before ImGui to prevent ` from appearing in input
@@ -166,6 +205,7 @@ struct ImHandler
 int main(const int argc, const char* argv[])
 {
     Boot::DefaultInit(argc, argv);
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::BootInit);
     auto handler = std::make_shared<ImHandler>();
     auto runner = std::make_shared<Sdl::Loop::Sdl3Runner>(
         handler,
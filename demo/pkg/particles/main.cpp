@@ -0,0 +1,359 @@
+#include "Boot/Boot.h"
+#include "Log/Log.h"
+#include "Sdl/Loop/Sdl3Runner.h"
+#include "Sdl/RendererScopes.h"
+#include "Sdl/Stats/FrameProfiler.h"
+#include "Sdl/Stats/FrameStats.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    constexpr int DefaultParticleCount = 100'000;
+    constexpr float DebugTextScale = 2.0f;
+    constexpr float DebugTextLineHeight = 8.0f;
+
+    constexpr float Gravity = 300.0f; // px/s^2
+    constexpr float ParticleSize = 2.0f;
+    constexpr float MaxDeltaSeconds = 1.0f / 20.0f; // keeps particles inside the bounds after stalls
+    constexpr size_t ChunkParticles = 16'384; // 4 vertices each fit 16-bit indices of one SDL_RenderGeometryRaw
+
+    using Clock = std::chrono::steady_clock;
+
+    float SecondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<float>(Clock::now() - start).count();
+    }
+
+    /// Particles in structure-of-arrays form: the kernels stream through separate coordinate arrays
+    class ParticleSystem
+    {
+    public:
+        ParticleSystem(size_t count, float width, float height)
+        {
+            std::minstd_rand random{42}; // same scene every run
+            std::uniform_real_distribution<float> unit{0.0f, 1.0f};
+            _x.resize(count);
+            _y.resize(count);
+            _vx.resize(count);
+            _vy.resize(count);
+            _colors.resize(count * 4);
+            for (size_t i = 0; i < count; ++i) {
+                _x[i] = unit(random) * width;
+                _y[i] = unit(random) * height;
+                _vx[i] = (unit(random) - 0.5f) * 400.0f;
+                _vy[i] = (unit(random) - 0.5f) * 400.0f;
+                const SDL_FColor color{0.3f + unit(random) * 0.7f, 0.3f + unit(random) * 0.7f, 1.0f, 1.0f};
+                std::fill_n(_colors.begin() + static_cast<ptrdiff_t>(i * 4), 4, color);
+            }
+            _xy.resize(count * 8);
+
+            const auto quads = std::min(count, ChunkParticles);
+            _indices.reserve(quads * 6);
+            for (size_t quad = 0; quad < quads; ++quad) {
+                const auto base = static_cast<uint16_t>(quad * 4);
+                for (const uint16_t corner : {0, 1, 2, 0, 2, 3}) {
+                    _indices.push_back(static_cast<uint16_t>(base + corner));
+                }
+            }
+        }
+
+        [[nodiscard]] size_t GetCount() const { return _x.size(); }
+
+        /// Gravity and elastic bounces off the bounds
+        void Update(float dt, float width, float height, bool simd)
+        {
+            size_t i = 0;
+#if defined(__SSE2__)
+            if (simd) {
+                i = UpdateSimd(dt, width, height);
+            }
+#endif
+            for (; i < _x.size(); ++i) {
+                _vy[i] += Gravity * dt;
+                _x[i] += _vx[i] * dt;
+                _y[i] += _vy[i] * dt;
+                if (_x[i] < 0.0f) {
+                    _x[i] = -_x[i];
+                    _vx[i] = -_vx[i];
+                } else if (_x[i] > width) {
+                    _x[i] = width + width - _x[i];
+                    _vx[i] = -_vx[i];
+                }
+                if (_y[i] < 0.0f) {
+                    _y[i] = -_y[i];
+                    _vy[i] = -_vy[i];
+                } else if (_y[i] > height) {
+                    _y[i] = height + height - _y[i];
+                    _vy[i] = -_vy[i];
+                }
+            }
+        }
+
+        /// Expand particles into quad corners and draw them, returns the draw call count
+        size_t Submit(SDL_Renderer* renderer, bool simd)
+        {
+            size_t i = 0;
+#if defined(__SSE2__)
+            if (simd) {
+                i = BuildQuadsSimd();
+            }
+#endif
+            constexpr float Half = ParticleSize * 0.5f;
+            for (; i < _x.size(); ++i) {
+                const float x0 = _x[i] - Half;
+                const float x1 = _x[i] + Half;
+                const float y0 = _y[i] - Half;
+                const float y1 = _y[i] + Half;
+                float* xy = _xy.data() + i * 8;
+                xy[0] = x0, xy[1] = y0;
+                xy[2] = x1, xy[3] = y0;
+                xy[4] = x1, xy[5] = y1;
+                xy[6] = x0, xy[7] = y1;
+            }
+
+            size_t drawCalls = 0;
+            for (size_t first = 0; first < _x.size(); first += ChunkParticles) {
+                const auto quads = std::min(ChunkParticles, _x.size() - first);
+                SDL_RenderGeometryRaw(renderer,
+                    nullptr,
+                    _xy.data() + first * 8,
+                    2 * sizeof(float),
+                    _colors.data() + first * 4,
+                    sizeof(SDL_FColor),
+                    nullptr,
+                    0,
+                    static_cast<int>(quads * 4),
+                    _indices.data(),
+                    static_cast<int>(quads * 6),
+                    sizeof(uint16_t));
+                drawCalls++;
+            }
+            return drawCalls;
+        }
+
+    private:
+        std::vector<float> _x;
+        std::vector<float> _y;
+        std::vector<float> _vx;
+        std::vector<float> _vy;
+        std::vector<float> _xy; // 4 corners per particle
+        std::vector<SDL_FColor> _colors; // per vertex, static
+        std::vector<uint16_t> _indices; // quads of one chunk, shared by all chunks
+
+#if defined(__SSE2__)
+        static __m128 Select(__m128 mask, __m128 a, __m128 b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+
+        /// 4 particles per step, returns the processed count (the tail is left to the scalar loop)
+        size_t UpdateSimd(float dt, float width, float height)
+        {
+            const auto count = _x.size() & ~size_t{3};
+            const __m128 delta = _mm_set1_ps(dt);
+            const __m128 gravity = _mm_set1_ps(Gravity * dt);
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 right = _mm_set1_ps(width);
+            const __m128 bottom = _mm_set1_ps(height);
+            const __m128 sign = _mm_set1_ps(-0.0f);
+            for (size_t i = 0; i < count; i += 4) {
+                __m128 x = _mm_loadu_ps(&_x[i]);
+                __m128 y = _mm_loadu_ps(&_y[i]);
+                __m128 vx = _mm_loadu_ps(&_vx[i]);
+                __m128 vy = _mm_add_ps(_mm_loadu_ps(&_vy[i]), gravity);
+                x = _mm_add_ps(x, _mm_mul_ps(vx, delta));
+                y = _mm_add_ps(y, _mm_mul_ps(vy, delta));
+
+                __m128 mask = _mm_cmplt_ps(x, zero);
+                x = Select(mask, _mm_xor_ps(x, sign), x);
+                vx = Select(mask, _mm_xor_ps(vx, sign), vx);
+                mask = _mm_cmpgt_ps(x, right);
+                x = Select(mask, _mm_sub_ps(_mm_add_ps(right, right), x), x);
+                vx = Select(mask, _mm_xor_ps(vx, sign), vx);
+
+                mask = _mm_cmplt_ps(y, zero);
+                y = Select(mask, _mm_xor_ps(y, sign), y);
+                vy = Select(mask, _mm_xor_ps(vy, sign), vy);
+                mask = _mm_cmpgt_ps(y, bottom);
+                y = Select(mask, _mm_sub_ps(_mm_add_ps(bottom, bottom), y), y);
+                vy = Select(mask, _mm_xor_ps(vy, sign), vy);
+
+                _mm_storeu_ps(&_x[i], x);
+                _mm_storeu_ps(&_y[i], y);
+                _mm_storeu_ps(&_vx[i], vx);
+                _mm_storeu_ps(&_vy[i], vy);
+            }
+            return count;
+        }
+
+        /// Corners of 4 particles per step, interleaved into (x, y) pairs
+        size_t BuildQuadsSimd()
+        {
+            const auto count = _x.size() & ~size_t{3};
+            const __m128 half = _mm_set1_ps(ParticleSize * 0.5f);
+            for (size_t i = 0; i < count; i += 4) {
+                const __m128 x = _mm_loadu_ps(&_x[i]);
+                const __m128 y = _mm_loadu_ps(&_y[i]);
+                const __m128 x0 = _mm_sub_ps(x, half);
+                const __m128 x1 = _mm_add_ps(x, half);
+                const __m128 y0 = _mm_sub_ps(y, half);
+                const __m128 y1 = _mm_add_ps(y, half);
+
+                // (x0 y0) (x1 y0) (x1 y1) (x0 y1) pairs of particles 0,1 (lo) and 2,3 (hi)
+                const __m128 tl = _mm_unpacklo_ps(x0, y0);
+                const __m128 tr = _mm_unpacklo_ps(x1, y0);
+                const __m128 br = _mm_unpacklo_ps(x1, y1);
+                const __m128 bl = _mm_unpacklo_ps(x0, y1);
+                const __m128 tlHi = _mm_unpackhi_ps(x0, y0);
+                const __m128 trHi = _mm_unpackhi_ps(x1, y0);
+                const __m128 brHi = _mm_unpackhi_ps(x1, y1);
+                const __m128 blHi = _mm_unpackhi_ps(x0, y1);
+
+                float* xy = _xy.data() + i * 8;
+                _mm_storeu_ps(xy + 0, _mm_movelh_ps(tl, tr));
+                _mm_storeu_ps(xy + 4, _mm_movelh_ps(br, bl));
+                _mm_storeu_ps(xy + 8, _mm_movehl_ps(tr, tl));
+                _mm_storeu_ps(xy + 12, _mm_movehl_ps(bl, br));
+                _mm_storeu_ps(xy + 16, _mm_movelh_ps(tlHi, trHi));
+                _mm_storeu_ps(xy + 20, _mm_movelh_ps(brHi, blHi));
+                _mm_storeu_ps(xy + 24, _mm_movehl_ps(trHi, tlHi));
+                _mm_storeu_ps(xy + 28, _mm_movehl_ps(blHi, brHi));
+            }
+            return count;
+        }
+#endif
+    };
+}
+
+struct ParticlesHandler
+    : RunLoop::Handler
+    , Sdl::Loop::Sdl3Handler
+{
+    ParticleSystem particles;
+    bool simd;
+    Sdl::Stats::FrameStats frameStats{300};
+    Sdl::Stats::FrameStats updateStats{300};
+    Sdl::Stats::FrameStats submitStats{300};
+
+    ParticlesHandler(int particleCount, bool simd)
+        : particles(static_cast<size_t>(particleCount), 1280.0f, 720.0f)
+        , simd(simd)
+    {
+    }
+
+    bool Start() override
+    {
+        Log::Info("{} particles, {} kernels (press S to switch)", particles.GetCount(), KernelName());
+        return true;
+    }
+
+    void Stop() override
+    {
+        Log::Info("{} particles {}: frame avg {:.2f} ms p99 {:.2f} ms, update avg {:.2f} ms, submit avg {:.2f} ms",
+            particles.GetCount(),
+            KernelName(),
+            frameStats.GetAverageSeconds() * 1000.0f,
+            frameStats.GetPercentileSeconds(0.99f) * 1000.0f,
+            updateStats.GetAverageSeconds() * 1000.0f,
+            submitStats.GetAverageSeconds() * 1000.0f);
+    }
+
+    void Update(const RunLoop::UpdateCtx& ctx) override
+    {
+        auto& runner = static_cast<Sdl::Loop::Sdl3Runner&>(ctx.Runner);
+        auto* renderer = runner.GetRenderer();
+        auto& renderState = runner.GetRenderState();
+        frameStats.AddFrame(ctx.frame.deltaSeconds);
+
+        int width = 0;
+        int height = 0;
+        SDL_GetCurrentRenderOutputSize(renderer, &width, &height);
+
+        const auto updateStart = Clock::now();
+        particles.Update(std::min(ctx.frame.deltaSeconds, MaxDeltaSeconds), static_cast<float>(width), static_cast<float>(height), simd);
+        updateStats.AddFrame(SecondsSince(updateStart));
+
+        size_t drawCalls = 0;
+        {
+            Sdl::Stats::FrameProfiler::Scope profileScope{Sdl::Stats::FramePhase::RenderSubmit};
+            const auto submitStart = Clock::now();
+            renderState.SetDrawColor(10, 10, 20);
+            SDL_RenderClear(renderer);
+            drawCalls = particles.Submit(renderer, simd);
+            submitStats.AddFrame(SecondsSince(submitStart));
+        }
+
+        // present and the rest of the frame are what's left of the frame time
+        const auto frameMs = frameStats.GetAverageSeconds() * 1000.0f;
+        const auto updateMs = updateStats.GetAverageSeconds() * 1000.0f;
+        const auto submitMs = submitStats.GetAverageSeconds() * 1000.0f;
+        Sdl::SetRenderScaleScope scaleScope{renderState, DebugTextScale, DebugTextScale};
+        renderState.SetDrawColor(255, 255, 0);
+        SDL_RenderDebugTextFormat(renderer, 4, 4, "%zu particles, %s (S - switch): %zu draws", particles.GetCount(), KernelName(), drawCalls);
+        SDL_RenderDebugTextFormat(renderer, 4, 4 + DebugTextLineHeight, "frame %.2f ms (%.1f FPS): update %.2f submit %.2f present+other %.2f ms",
+            frameMs,
+            frameStats.GetAverageFps(),
+            updateMs,
+            submitMs,
+            std::max(frameMs - updateMs - submitMs, 0.0f));
+    }
+
+    SDL_AppResult Sdl3Event(Sdl::Loop::Sdl3Runner& runner, const SDL_Event& event) override
+    {
+        if (event.type == SDL_EVENT_QUIT) {
+            return SDL_APP_SUCCESS;
+        }
+        if (event.type == SDL_EVENT_KEY_DOWN) {
+            if (event.key.key == SDLK_ESCAPE) {
+                return SDL_APP_SUCCESS;
+            }
+            if (event.key.key == SDLK_S) {
+                simd = !simd;
+                frameStats.Reset();
+                updateStats.Reset();
+                submitStats.Reset();
+                Log::Info("kernels {}", KernelName());
+            }
+        }
+        return SDL_APP_CONTINUE;
+    }
+
+private:
+    [[nodiscard]] const char* KernelName() const
+    {
+#if defined(__SSE2__)
+        return simd ? "simd" : "scalar";
+#else
+        return "scalar"; // no SIMD kernels for this target
+#endif
+    }
+};
+
+int main(const int argc, const char* argv[])
+{
+    auto args = Boot::DefaultInit(argc, argv);
+    auto particleCount = std::max(args.GetIntArg(1).value_or(DefaultParticleCount), 1);
+    auto simd = args.GetIntArg(2).value_or(1) != 0;
+
+    auto handler = std::make_shared<ParticlesHandler>(particleCount, simd);
+    auto runner = std::make_shared<Sdl::Loop::Sdl3Runner>(
+        handler,
+        handler,
+        Sdl::Loop::Sdl3Runner::Options{
+            .Window = {
+                .Title = "Particles",
+                .Width = 1280,
+                .Height = 720,
+            },
+            .VSync = 0, // measure uncapped frame time
+        }
+    );
+    return runner->Run();
+}
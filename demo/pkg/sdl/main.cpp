@@ -1,25 +1,50 @@
-#include "Asio/AsioDomain.h"
 #include "Boot/Boot.h"
-#include "FpsCounter.h"
+#include "Fs/System.h"
 #include "Log/Log.h"
 #include "RunLoop/CompositeHandler.h"
+#include "Sdl/Loop/AsioPump.h"
+#include "Sdl/Loop/EventStream.h"
 #include "Sdl/Loop/Sdl3Runner.h"
+#include "Sdl/Render/DebugText.h"
+#include "Sdl/Render/PrimitiveBatch.h"
+#include "Sdl/Stats/FrameStats.h"
+#include "Sdl/Stats/StartupTrace.h"
+#include "Sdl/TextureLoader.h"
+#include <boost/asio/as_tuple.hpp>
+#include <boost/asio/bind_cancellation_slot.hpp>
+#include <boost/asio/cancellation_signal.hpp>
+#include <boost/asio/co_spawn.hpp>
 #include <boost/asio/experimental/awaitable_operators.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
 
 namespace
 {
     static constexpr int DefaultTimeoutSeconds = 10; // 0 means no timeout, wait for quit event
     static constexpr float DebugTextLineHeight = 8.0f; // SDL_RenderDebugText line height in scaled coordinates
     static constexpr float DebugTextScale = 3.0f; // Scale applied to debug text rendering
+    static constexpr const char* SampleImagePath = "demo/try/sdl3-2/data/sample.bmp"; // runfiles relative
 }
 
-[[maybe_unused]] static boost::asio::awaitable<int> CoroMain(
+/// Quit event or ESC key, received through the runner's event hub
+static boost::asio::awaitable<SDL_Event> AsyncQuitRequest(Sdl::Loop::Sdl3Runner& runner)
+{
+    Sdl::Loop::EventStream events{runner.GetEvents()};
+    while (true) {
+        auto event = co_await events.Next();
+        if (event.type == SDL_EVENT_QUIT || (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_ESCAPE)) {
+            co_return event;
+        }
+    }
+}
+
+static boost::asio::awaitable<int> CoroMain(
     std::shared_ptr<Sdl::Loop::Sdl3Runner> runner, int timeoutSeconds)
 {
     if (timeoutSeconds <= 0) {
-        Log::Info("WAITING: stop signal...");
-        co_await Asio::AsyncCancelled();
-        Log::Info("EXITING: stop signal received");
+        Log::Info("WAITING: quit event...");
+        auto event = co_await AsyncQuitRequest(*runner);
+        Log::Info("EXITING: quit requested by event {}", event.type);
     } else {
         namespace asio = boost::asio;
         using namespace asio::experimental::awaitable_operators;
@@ -31,17 +56,16 @@ namespace
 
         auto timer = asio::steady_timer(executor);
         timer.expires_after(std::chrono::seconds(timeoutSeconds));
-        auto result = co_await (Asio::AsyncCancelled() || timer.async_wait(asio::as_tuple(asio::use_awaitable)));
+        auto result = co_await (AsyncQuitRequest(*runner) || timer.async_wait(asio::as_tuple(asio::use_awaitable)));
 
         if (result.index() == 0) {
-            auto ec = std::get<0>(result);
-            Log::Info("EXITING: window was closed by user: {}", ec ? ec.what() : "<success>");
+            Log::Info("EXITING: quit requested by event {}", std::get<0>(result).type);
         } else {
             auto [ec] = std::get<1>(result);
             Log::Info("EXITING: timeout is reached: {}", ec ? ec.what() : "<success>");
         }
     }
-    co_return timeoutSeconds;
+    co_return RunLoop::ExitCode::Success;
 }
 
 
@@ -49,22 +73,45 @@ struct MyHandler
     : RunLoop::Handler
     , Sdl::Loop::Sdl3Handler
 {
-    FpsCounter fpsCounter;
+    Sdl::Stats::FrameStats frameStats;
+    std::optional<Sdl::Render::PrimitiveBatch> batch;
+    std::optional<Sdl::Render::DebugText> debugText;
+    std::optional<Sdl::TextureLoader> loader;
+    Sdl::TextureLoader::Handle sampleImage;
+
+    void Stop() override
+    {
+        sampleImage = {};
+        loader.reset(); // textures go before the renderer
+        debugText.reset();
+    }
 
     void Update(const RunLoop::UpdateCtx& ctx) override
     {
-        auto* renderer = (dynamic_cast<Sdl::Loop::Sdl3Runner&>(ctx.Runner)).GetRenderer();
+        auto& runner = dynamic_cast<Sdl::Loop::Sdl3Runner&>(ctx.Runner);
+        auto* renderer = runner.GetRenderer();
+        auto& renderState = runner.GetRenderState();
+        if (!batch) {
+            batch.emplace(renderState);
+            debugText.emplace(renderState);
+            loader.emplace(renderer, Fs::System::MakeDefaultDrive());
+            sampleImage = loader->Load(SampleImagePath); // placeholder is drawn until it's decoded and uploaded
+        }
+        loader->Update();
 
-        // FPS counter
-        fpsCounter.AddFrame(ctx.frame.deltaSeconds);
+        // Frame statistics
+        frameStats.AddFrame(ctx.frame.deltaSeconds);
 
         // Accumulate elapsed time from frame deltas
         auto elapsed = ctx.session.passedSeconds;
 
         // Clear with dark blue
-        SDL_SetRenderDrawColor(renderer, 30, 30, 130, 255);
+        renderState.SetDrawColor(30, 30, 130);
         SDL_RenderClear(renderer);
 
+        const SDL_FRect imageRect{440.0f, 300.0f, 160.0f, 160.0f};
+        SDL_RenderTexture(renderer, sampleImage.Get(), nullptr, &imageRect);
+
         // Animated rectangle - moves in circle and pulses
         float centerX = 320.0f;
         float centerY = 240.0f;
@@ -77,49 +124,58 @@ struct MyHandler
         auto r = static_cast<Uint8>(200 + 55 * std::sinf(elapsed * 3.0f));
         auto g = static_cast<Uint8>(80 + 40 * std::sinf(elapsed * 2.0f));
 
-        SDL_SetRenderDrawColor(renderer, r, g, 50, 255);
         SDL_FRect rect = {
             .x=x - size / 2, 
             .y=y - size / 2, 
             .w=size, 
             .h=size
         };
-        SDL_RenderFillRect(renderer, &rect);
+        batch->AddRect(rect, SDL_Color{r, g, 50, 255});
 
         // Second rectangle rotating opposite direction
         float x2 = centerX + radius * std::cosf(-elapsed * 1.5f);
         float y2 = centerY + radius * std::sinf(-elapsed * 1.5f);
-        SDL_SetRenderDrawColor(renderer, 100, 200, 100, 255);
         SDL_FRect rect2 = {
             .x=x2 - 25,
             .y=y2 - 25,
             .w=50, 
             .h=50
         };
-        SDL_RenderFillRect(renderer, &rect2);
+        batch->AddRect(rect2, SDL_Color{100, 200, 100, 255});
+        batch->Flush(); // both rectangles in one draw
 
         // Render debug text overlay
-        RenderDebugText(renderer, ctx);
+        RenderDebugText(renderState.GetRenderer(), ctx);
     }
 
-    void RenderDebugText(SDL_Renderer* renderer, const RunLoop::UpdateCtx& ctx) const
+    void RenderDebugText(SDL_Renderer* renderer, const RunLoop::UpdateCtx& ctx)
     {
-        // Render debug text with session and frame info - scaled 2x
-        float scaleX = {};
-        float scaleY = {};
-        SDL_GetRenderScale(renderer, &scaleX, &scaleY);
-        SDL_SetRenderScale(renderer, DebugTextScale, DebugTextScale);
-        
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);  // Yellow color
+        // Lines are formatted into one cached geometry batch, scaled 3x
+        auto& text = *debugText;
+        text.SetScale(DebugTextScale);
+        text.SetColor(255, 255, 0);  // Yellow color
         auto textY = 0.0f;
-        SDL_RenderDebugTextFormat(renderer, 5.0f, textY+DebugTextLineHeight*0.f, "Session Time: %.2f s", ctx.session.passedSeconds);
-        SDL_RenderDebugTextFormat(renderer, 5.0f, textY+DebugTextLineHeight*1.f, "Frame Index: %llu", static_cast<unsigned long long>(ctx.frame.index));
-        SDL_RenderDebugTextFormat(renderer, 5.0f, textY+DebugTextLineHeight*2.f, "Delta: %.2f ms", ctx.frame.deltaSeconds * 1000.0f);
-        SDL_RenderDebugTextFormat(renderer, 5.0f, textY+DebugTextLineHeight*3.f, "Avg FPS: %.1f", fpsCounter.GetAverageFps());
-        // Render header lines 4 through 10
-        for (int i = 4; i <= 10; ++i) {
+        text.Printf(5.0f, textY+DebugTextLineHeight*0.f, "Session Time: %.2f s", ctx.session.passedSeconds);
+        text.Printf(5.0f, textY+DebugTextLineHeight*1.f, "Frame Index: %llu", static_cast<unsigned long long>(ctx.frame.index));
+        text.Printf(5.0f, textY+DebugTextLineHeight*2.f, "Delta: %.2f ms", ctx.frame.deltaSeconds * 1000.0f);
+        text.Printf(5.0f, textY+DebugTextLineHeight*3.f, "Avg FPS: %.1f (jitter %.2f ms)", frameStats.GetAverageFps(), frameStats.GetJitterSeconds() * 1000.0f);
+        text.Printf(5.0f, textY+DebugTextLineHeight*4.f, "p50/p95/p99/max: %.1f/%.1f/%.1f/%.1f ms",
+            frameStats.GetPercentileSeconds(0.50f) * 1000.0f,
+            frameStats.GetPercentileSeconds(0.95f) * 1000.0f,
+            frameStats.GetPercentileSeconds(0.99f) * 1000.0f,
+            frameStats.GetMaxSeconds() * 1000.0f);
+        text.Printf(5.0f, textY+DebugTextLineHeight*5.f, "Over budget: %zu/%zu (total %llu)",
+            frameStats.GetOverBudgetCount(),
+            frameStats.GetSampleCount(),
+            static_cast<unsigned long long>(frameStats.GetTotalOverBudgetCount()));
+        const auto& allocations = dynamic_cast<Sdl::Loop::Sdl3Runner&>(ctx.Runner).GetFrameAllocations();
+        text.Printf(5.0f, textY+DebugTextLineHeight*6.f, "Allocs/frame: %llu (%llu bytes)",
+            static_cast<unsigned long long>(allocations.allocations),
+            static_cast<unsigned long long>(allocations.bytes));
+        // Render header lines 7 through 10
+        for (int i = 7; i <= 10; ++i) {
             auto headerY = textY + DebugTextLineHeight * i;
-            SDL_RenderDebugTextFormat(renderer, 5.0f, headerY, "Header line %d", i);
+            text.Printf(5.0f, headerY, "Header line %d", i);
         }
 
         // Status bar at the bottom
@@ -130,28 +186,19 @@ struct MyHandler
         // Render lines 10 through 1
         for (int i = 10; i >= 1; --i) {
             auto lineY = statusBaseY + DebugTextLineHeight * (10 - i);
-            SDL_RenderDebugTextFormat(renderer, 5.0f, lineY, "Status line %d", i);
+            text.Printf(5.0f, lineY, "Status line %d", i);
         }
         // Render status line
         auto statusY = statusBaseY + DebugTextLineHeight * 10;
-        SDL_RenderDebugTextFormat(renderer, 5.0f, statusY, "Status: Running | Press ESC to quit");
-
-        SDL_SetRenderScale(renderer, scaleX, scaleY);
+        text.Print(5.0f, statusY, "Status: Running | Press ESC to quit");
+        text.Flush();
     }
 
-    SDL_AppResult Sdl3Event(Sdl::Loop::Sdl3Runner& runner, const SDL_Event& event) override
+    SDL_AppResult Sdl3Event(Sdl::Loop::Sdl3Runner& /*runner*/, const SDL_Event& event) override
     {
-        if (event.type == SDL_EVENT_QUIT) {
-            Log::Info("received SDL_EVENT_QUIT");
-            return SDL_APP_SUCCESS;
-        }
+        // quit and ESC are awaited by CoroMain
         if (event.type == SDL_EVENT_KEY_DOWN) {
-            if (event.key.key == SDLK_ESCAPE) {
-                Log::Info("ESC({}) pressed, quitting by event", static_cast<int>(event.key.key));
-                return SDL_APP_SUCCESS;
-            } else {
-                Log::Trace("Key({}) pressed", static_cast<int>(event.key.key));
-            }
+            Log::Trace("Key({}) pressed", static_cast<int>(event.key.key));
         }
         return SDL_APP_CONTINUE;
     }
@@ -159,10 +206,19 @@ struct MyHandler
 
 int main(const int argc, const char* argv[])
 {
+    namespace asio = boost::asio;
+
     // Get timeout from first argument
     auto args = Boot::DefaultInit(argc, argv);
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::BootInit);
     auto timeoutSeconds = args.GetIntArg(1).value_or(DefaultTimeoutSeconds);
 
+    // Coroutines run on the loop thread: the runner pumps the context before every frame update
+    // (context and stop signal are on the heap: on emscripten Run leaves main w/o unwinding while the loop goes on)
+    auto context = std::make_shared<asio::io_context>();
+    auto stop = std::make_shared<asio::cancellation_signal>();
+    auto pump = std::make_shared<Sdl::Loop::AsioPump>(*context);
+
     // Configure SDL3 runner
     auto composite = std::make_shared<RunLoop::CompositeHandler>();
     auto handler = std::make_shared<MyHandler>();
@@ -176,11 +232,25 @@ int main(const int argc, const char* argv[])
                 .Width = 640,
                 .Height = 480,
             },
+            .Pump = pump,
         }
     );
 
-    // Create domain with custom runner
-    auto domain = std::make_shared<Asio::AsioDomain>(CoroMain(runner, timeoutSeconds));
-    composite->Add(*domain);
-    return runner->Run();
+    asio::co_spawn(pump->GetExecutor(), CoroMain(runner, timeoutSeconds),
+        asio::bind_cancellation_slot(stop->slot(), [runner](std::exception_ptr error, int exitCode) {
+            if (error) {
+                Log::Error("CoroMain failed");
+                exitCode = RunLoop::ExitCode::Failure;
+            }
+            if (runner->IsRunning()) {
+                runner->Exit(exitCode);
+            }
+        }));
+    const auto exitCode = runner->Run();
+
+    // the loop may end first (harness frame limit): unwind the waiting coroutine before the context goes
+    stop->emit(asio::cancellation_type::terminal);
+    context->restart();
+    context->poll();
+    return exitCode;
 }
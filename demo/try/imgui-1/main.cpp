@@ -4,6 +4,7 @@
 
 #include "Boot/Boot.h"
 #include "Log/Log.h"
+#include "Sdl/Stats/StartupTrace.h"
 
 #include "imgui.h"
 #include "imgui_impl_sdl3.h"
@@ -23,6 +24,7 @@
 int main(int argc, const char** argv)
 {
     Boot::DefaultInit(argc, argv);
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::BootInit);
     Log::Info("ImGUI 1st try demo, ImGUI version: {}", ImGui::GetVersion());
 
     // Setup SDL
@@ -32,6 +34,7 @@ int main(int argc, const char** argv)
         printf("Error: SDL_Init(): %s\n", SDL_GetError());
         return 1;
     }
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::SdlInit);
 
     // Create window with SDL_Renderer graphics context
     float main_scale = SDL_GetDisplayContentScale(SDL_GetPrimaryDisplay());
@@ -42,6 +45,7 @@ int main(int argc, const char** argv)
         printf("Error: SDL_CreateWindow(): %s\n", SDL_GetError());
         return 1;
     }
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::Window);
     SDL_Renderer* renderer = SDL_CreateRenderer(window, nullptr);
     SDL_SetRenderVSync(renderer, 1);
     if (renderer == nullptr)
@@ -49,6 +53,7 @@ int main(int argc, const char** argv)
         SDL_Log("Error: SDL_CreateRenderer(): %s\n", SDL_GetError());
         return 1;
     }
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::Renderer);
     SDL_SetWindowPosition(window, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED);
     SDL_ShowWindow(window);
 
@@ -119,6 +124,7 @@ int main(int argc, const char** argv)
     io.Fonts->AddFontFromFileTTF(font_path.c_str(), size_pixels);
 #endif
     //IM_ASSERT(font != nullptr);
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::HandlerStart);
 
     // Our state
     bool show_demo_window = true;
@@ -209,6 +215,7 @@ int main(int argc, const char** argv)
         SDL_RenderClear(renderer);
         ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), renderer);
         SDL_RenderPresent(renderer);
+        Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::FirstPresent);
     }
 #ifdef __EMSCRIPTEN__
     EMSCRIPTEN_MAINLOOP_END;
@@ -223,6 +230,7 @@ int main(int argc, const char** argv)
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
+    Sdl::Stats::StartupTrace::Finish("imgui-1");
 
     return 0;
 }
@@ -1,5 +1,6 @@
 #include "Boot/Boot.h"
 #include "Log/Log.h"
+#include "Sdl/Stats/StartupTrace.h"
 
 #include <SDL3/SDL.h>
 
@@ -54,11 +55,13 @@ void mainLoop(void* arg)
     SDL_RenderFillRect(ctx->renderer, &rect);
 
     SDL_RenderPresent(ctx->renderer);
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::FirstPresent);
 }
 
 int main(int argc, const char* argv[])
 {
     Boot::LogHeader({argc, argv});
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::BootInit);
     Log::Info("SDL3 try demo 1st");
     int version = SDL_GetVersion();
     int major = SDL_VERSIONNUM_MAJOR(version);
@@ -72,6 +75,7 @@ int main(int argc, const char* argv[])
         SDL_Log("SDL_Init failed: %s", SDL_GetError());
         return 1;
     }
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::SdlInit);
 
     // 2. Window creation
     Log::Info("SDL_CreateWindow...");
@@ -88,6 +92,7 @@ int main(int argc, const char* argv[])
         SDL_Quit();
         return 1;
     }
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::Window);
 
     // 3. Renderer creation
     Log::Info("SDL_CreateRenderer...");
@@ -98,6 +103,7 @@ int main(int argc, const char* argv[])
         SDL_Quit();
         return 1;
     }
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::Renderer);
 
     // Create context for main loop
     Log::Info("Context...");
@@ -129,6 +135,7 @@ int main(int argc, const char* argv[])
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
+    Sdl::Stats::StartupTrace::Finish("sdl3-1");
 
     return 0;
 }
@@ -1,5 +1,6 @@
 #include "Boot/Boot.h"
 #include "Log/Log.h"
+#include "Sdl/Stats/StartupTrace.h"
 
 //TODO: simple wrapper as SDL3pp fails yet w/ clang and C++20
 /**
@@ -52,6 +53,7 @@ SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[])
 #endif
 
     Boot::LogHeader({argc, argv});
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::BootInit);
     Log::Info("SDL3 try demo 1st");
     int version = SDL_GetVersion();
     int major = SDL_VERSIONNUM_MAJOR(version);
@@ -69,6 +71,7 @@ SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[])
         Log::Error("Couldn't initialize SDL: {}", SDL_GetError());
         return SDL_APP_FAILURE;
     }
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::SdlInit);
 
     if (!SDL_CreateWindowAndRenderer(
             "examples/renderer/textures",
@@ -81,6 +84,8 @@ SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[])
         Log::Error("Couldn't create window/renderer: {}", SDL_GetError());
         return SDL_APP_FAILURE;
     }
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::Window);
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::Renderer);
 
     /* Textures are pixel data that we upload to the video hardware for fast drawing. Lots of 2D
        engines refer to these as "sprites." We'll do a static texture (upload once, draw many
@@ -125,6 +130,7 @@ SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[])
     }
 
     SDL_DestroySurface(surface); /* done with this, the texture has a copy of the pixels now. */
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::HandlerStart);
 
     return SDL_APP_CONTINUE; /* carry on with the program! */
 }
@@ -136,6 +142,7 @@ void SDL_AppQuit(void* appstate, SDL_AppResult result)
         SDL_DestroyTexture(texture);
     }
     /* SDL will clean up the window/renderer for us. */
+    Sdl::Stats::StartupTrace::Finish("sdl3-2");
 }
 
 /* This function runs when a new event (mouse input, keypresses, etc) occurs. */
@@ -190,6 +197,7 @@ SDL_AppResult SDL_AppIterate(void* appstate)
     }
 
     SDL_RenderPresent(renderer); /* put it all on the screen! */
+    Sdl::Stats::StartupTrace::Mark(Sdl::Stats::StartupMark::FirstPresent);
 
     return SDL_APP_CONTINUE; /* carry on with the program! */
 }
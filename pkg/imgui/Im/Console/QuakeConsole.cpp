@@ -1,11 +1,14 @@
 #include "QuakeConsole.h"
 #include "Log/Log.h"
 #include "Log/Sink.h"
+#include "Sdl/Stats/Trace.h"
 
 #include "imgui.h"
 #include "imgui_internal.h"
 #include <array>
+#include <sstream>
 #include <string>
+#include <string_view>
 
 namespace Im
 {
@@ -48,6 +51,23 @@ namespace Im
         Log::Fatal("This is a Critical message");
     }
 
+    static void TraceCommand(const std::string& command)
+    {
+        static constexpr std::string_view DefaultTracePath = "trace.json";
+
+        std::istringstream stream{command};
+        std::string name, action, path;
+        stream >> name >> action >> path;
+        if (action == "start") {
+            Sdl::Stats::Trace::Start();
+        } else if (action == "stop") {
+            Sdl::Stats::Trace::Stop();
+            Sdl::Stats::Trace::WriteJson(path.empty() ? std::string{DefaultTracePath} : path);
+        } else {
+            Log::Warn("Usage: trace start|stop [file]");
+        }
+    }
+
     QuakeConsole::QuakeConsole(bool initiallyVisible)
         : _buffer(std::make_shared<Detail::ConsoleBuffer>(MAX_BUFFER_SIZE))
         , _sink(std::make_shared<Detail::ConsoleSinkMt>(_buffer))
@@ -82,6 +102,7 @@ namespace Im
 
     void QuakeConsole::Render()
     {
+        TX_TRACE_SCOPE("QuakeConsole::Render");
         // Don't render if fully hidden
         if (!_visible && _animationProgress <= 0.0f) {
             return;
@@ -410,7 +431,8 @@ namespace Im
         // Log the command
         Log::Info("{}", command);
 
-        // Process commands
+        // Process commands (those with arguments are matched by their first word)
+        const auto name = std::string_view{command}.substr(0, command.find(' '));
         if (command == "clear") {
             Clear();
         } else if (command == "help") {
@@ -418,8 +440,11 @@ namespace Im
             Log::Info("  help  - Show this help message");
             Log::Info("  clear - Clear console output");
             Log::Info("  test  - Test all log levels");
+            Log::Info("  trace start|stop [file] - Record a Chrome trace (written to trace.json by default)");
         } else if (command == "test") {
             TestCommand();
+        } else if (name == "trace") {
+            TraceCommand(command);
         } else {
             Log::Warn("Unknown command: '{}'. Type 'help' for available commands.", command);
         }
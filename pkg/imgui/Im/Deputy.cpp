@@ -4,8 +4,14 @@
 #include "Fs/System.h"
 
 #include "Sdl/RendererScopes.h"
+#include "Sdl/Stats/AllocTracker.h"
+#include "Sdl/Stats/FrameProfiler.h"
+#include "Sdl/Stats/Trace.h"
+#include <SDL3/SDL_error.h>
 #include <SDL3/SDL_render.h>
 #include <SDL3/SDL_video.h>
+#include <cstdlib>
+#include <string_view>
 
 #include "imgui_impl_sdl3.h"
 #include "imgui_impl_sdlrenderer3.h"
@@ -22,6 +28,62 @@ namespace Im
         DefaultMonoFont,
     };
 
+    static Deputy::Backend BackendFromEnvironment(Deputy::Backend fallback)
+    {
+        const char* value = std::getenv("TX_IMGUI_BACKEND");
+        if (!value || !*value) {
+            return fallback;
+        }
+        const std::string_view name{value};
+        if (name == "software") {
+            return Deputy::Backend::Software;
+        }
+        if (name == "sdl") {
+            return Deputy::Backend::SdlRenderer;
+        }
+        return fallback;
+    }
+
+    static Deputy::Allocator AllocatorFromEnvironment(Deputy::Allocator fallback)
+    {
+        const char* value = std::getenv("TX_IMGUI_ALLOCATOR");
+        if (!value || !*value) {
+            return fallback;
+        }
+        const std::string_view name{value};
+        if (name == "pool") {
+            return Deputy::Allocator::Pool;
+        }
+        if (name == "system") {
+            return Deputy::Allocator::System;
+        }
+        return fallback;
+    }
+
+    static bool IsPoolAllocatorInstalled()
+    {
+        ImGuiMemAllocFunc allocFunc{};
+        ImGuiMemFreeFunc freeFunc{};
+        void* userData{};
+        ImGui::GetAllocatorFunctions(&allocFunc, &freeFunc, &userData);
+        return allocFunc == PoolAllocator::ImGuiAlloc;
+    }
+
+    // ImGui allocates w/ malloc (not operator new), counted separately when the allocation hooks are linked
+    static void* TrackedImGuiAlloc(size_t size, void* /*userData*/)
+    {
+        Sdl::Stats::AllocTracker::OnAlloc(size);
+        return std::malloc(size);
+    }
+
+    static void TrackedImGuiFree(void* ptr, void* /*userData*/)
+    {
+        if (ptr) {
+            Sdl::Stats::AllocTracker::OnFree();
+            std::free(ptr);
+        }
+    }
+
     static Log::Logger _internalImGuiLogger{"ImGui"};
     Log::Logger Deputy::_logger = Log::Logger("Im.Deputy");
 
@@ -29,11 +91,24 @@ namespace Im
         : _window(config.window)
         , _renderer(config.renderer)
         , _drive(std::move(config.drive))
+        , _ownRenderState(config.renderState ? nullptr : std::make_unique<Sdl::RenderState>(config.renderer))
+        , _renderState(config.renderState ? config.renderState : _ownRenderState.get())
+        , _backend(BackendFromEnvironment(config.backend))
+        , _allocator(AllocatorFromEnvironment(config.allocator))
     {
         // context
         IMGUI_CHECKVERSION();
         _logger.Debug("ImGUI {}", ImGui::GetVersion());
 
+        // allocator functions are global: installed before the first allocation and can't change while blocks live
+        if (IsPoolAllocatorInstalled()) {
+            _allocator = Allocator::Pool;
+        } else if (_allocator == Allocator::Pool) {
+            _logger.Info("allocator: pool");
+            ImGui::SetAllocatorFunctions(PoolAllocator::ImGuiAlloc, PoolAllocator::ImGuiFree, &PoolAllocator::Shared());
+        } else if (Sdl::Stats::AllocTracker::IsHooked()) {
+            ImGui::SetAllocatorFunctions(TrackedImGuiAlloc, TrackedImGuiFree);
+        }
         auto* context = ImGui::CreateContext();
         _context = context;
 
@@ -69,13 +144,27 @@ namespace Im
         LoadFonts();
 
         // backend/renderer
-        ImGui_ImplSDL3_InitForSDLRenderer(_window, _renderer);
-        ImGui_ImplSDLRenderer3_Init(_renderer);
+        if (_backend == Backend::Software) {
+            _logger.Info("renderer: software");
+            ImGui_ImplSDL3_InitForOther(_window);
+            _softRenderer = std::make_unique<SoftRenderer>();
+            _softRenderer->Init();
+        } else {
+            ImGui_ImplSDL3_InitForSDLRenderer(_window, _renderer);
+            ImGui_ImplSDLRenderer3_Init(_renderer);
+        }
     }
 
     Deputy::~Deputy()
     {
-        ImGui_ImplSDLRenderer3_Shutdown();
+        if (_softRenderer) {
+            _softRenderer->Shutdown();
+            _softRenderer.reset();
+            _softTexture.reset();
+            _softSurface.reset();
+        } else {
+            ImGui_ImplSDLRenderer3_Shutdown();
+        }
         ImGui_ImplSDL3_Shutdown();
 
         _io = {};
@@ -83,6 +172,11 @@ namespace Im
         _context = {};
     }
 
+    const PoolAllocator::Stats* Deputy::GetAllocatorStats() const
+    {
+        return _allocator == Allocator::Pool ? &PoolAllocator::Shared().GetStats() : nullptr;
+    }
+
     void Deputy::LoadFonts()
     {
         bool fontLoaded = false;
@@ -101,6 +195,7 @@ namespace Im
 
     bool Deputy::LoadFont(const Fs::Path& fontPath, const char* fontName, float fontSize)
     {
+        TX_TRACE_SCOPE("Deputy::LoadFont");
         auto sizeResult = _drive->GetSize(fontPath);
         if (!sizeResult) {
             _logger.Debug("GetSize failed: {} ({})", fontPath.c_str(), sizeResult.error().message());
@@ -127,7 +222,11 @@ namespace Im
 
     void Deputy::UpdateBegin()
     {
-        ImGui_ImplSDLRenderer3_NewFrame();
+        TX_TRACE_SCOPE("Deputy::UpdateBegin");
+        Sdl::Stats::FrameProfiler::Scope profileScope{Sdl::Stats::FramePhase::ImGuiBuild};
+        if (!_softRenderer) {
+            ImGui_ImplSDLRenderer3_NewFrame();
+        }
         ImGui_ImplSDL3_NewFrame();
         ImGui::NewFrame();
 
@@ -144,13 +243,60 @@ namespace Im
 
     void Deputy::UpdateEnd()
     {
-        ImGui::Render();
+        TX_TRACE_SCOPE("Deputy::UpdateEnd");
+        {
+            Sdl::Stats::FrameProfiler::Scope profileScope{Sdl::Stats::FramePhase::ImGuiBuild};
+            ImGui::Render();
+        }
 
+        Sdl::Stats::FrameProfiler::Scope profileScope{Sdl::Stats::FramePhase::RenderSubmit};
         auto* drawData = ImGui::GetDrawData();
-        Sdl::SetRenderScaleScope scaleScope{_renderer, _io->DisplayFramebufferScale.x, _io->DisplayFramebufferScale.y};
+        if (_softRenderer) {
+            RenderSoftware(drawData);
+            return;
+        }
+        // the backend restores viewport and clip rect it changes, so the shadow stays valid
+        Sdl::SetRenderScaleScope scaleScope{*_renderState, _io->DisplayFramebufferScale.x, _io->DisplayFramebufferScale.y};
         ImGui_ImplSDLRenderer3_RenderDrawData(drawData, _renderer);
     }
 
+    void Deputy::RenderSoftware(ImDrawData* drawData)
+    {
+        const int width = static_cast<int>(drawData->DisplaySize.x * drawData->FramebufferScale.x);
+        const int height = static_cast<int>(drawData->DisplaySize.y * drawData->FramebufferScale.y);
+        if (width <= 0 || height <= 0) {
+            return;
+        }
+
+        if (!_softSurface || _softSurface->w != width || _softSurface->h != height) {
+            _softTexture.reset();
+            _softSurface.reset(SDL_CreateSurface(width, height, SoftRenderer::PixelFormat));
+            if (!_softSurface) {
+                _logger.Error("SDL_CreateSurface: {}", SDL_GetError());
+                return;
+            }
+            _softTexture.reset(SDL_CreateTexture(_renderer, SoftRenderer::PixelFormat, SDL_TEXTUREACCESS_STREAMING, width, height));
+            if (!_softTexture) {
+                _logger.Error("SDL_CreateTexture: {}", SDL_GetError());
+                return;
+            }
+            SDL_SetTextureBlendMode(_softTexture.get(), SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+            SDL_SetTextureScaleMode(_softTexture.get(), SDL_SCALEMODE_NEAREST);
+        }
+
+        SDL_FillSurfaceRect(_softSurface.get(), nullptr, 0);
+        _softRenderer->RenderDrawData(drawData, _softSurface.get());
+
+        if (_softTexture) {
+            SDL_UpdateTexture(_softTexture.get(), nullptr, _softSurface->pixels, _softSurface->pitch);
+            // the surface is in framebuffer pixels, so it covers the whole output at unit scale
+            Sdl::SetRenderScaleScope scaleScope{*_renderState, 1.0f, 1.0f};
+            Sdl::SetViewportScope viewportScope{*_renderState, std::nullopt};
+            Sdl::SetClipRectScope clipScope{*_renderState, std::nullopt};
+            SDL_RenderTexture(_renderer, _softTexture.get(), nullptr, nullptr);
+        }
+    }
+
     void Deputy::ProcessSdlEvent(const SDL_Event& event)
     {
         ImGui_ImplSDL3_ProcessEvent(&event);
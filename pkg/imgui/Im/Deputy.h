@@ -1,7 +1,12 @@
 #pragma once
 #include "Fs/Drive.h"
+#include "Im/PoolAllocator.h"
+#include "Im/SoftRenderer.h"
 #include "Log/Log.h"
+#include "Sdl/RenderState.h"
+#include "Sdl/Sdl3Ptr.h"
 #include "imgui.h"
+#include <cstdint>
 #include <memory>
 
 struct SDL_Window;
@@ -15,11 +20,26 @@ namespace Im
         static Log::Logger _logger;
 
     public:
+        enum class Backend : uint8_t
+        {
+            SdlRenderer, // ImGui's SDL_Renderer backend
+            Software, // CPU rasterized by SoftRenderer, then composited as one texture (deterministic pixels)
+        };
+
+        enum class Allocator : uint8_t
+        {
+            System, // malloc/free (ImGui's default)
+            Pool, // PoolAllocator::Shared() size classes (stays installed for the process lifetime)
+        };
+
         struct Config
         {
             SDL_Window* window;
             SDL_Renderer* renderer;
             std::shared_ptr<Fs::Drive> drive;
+            Sdl::RenderState* renderState{}; // shared renderer state shadow (own one is created when not set)
+            Backend backend = Backend::SdlRenderer; // TX_IMGUI_BACKEND=software|sdl environment variable overrides
+            Allocator allocator = Allocator::System; // TX_IMGUI_ALLOCATOR=pool|system environment variable overrides
         };
 
         Deputy(Config config);
@@ -31,14 +51,30 @@ namespace Im
 
         [[nodiscard]] const ImGuiIO& GetImGuiIO() const { return *_io; }
         [[nodiscard]] ImGuiID GetDockSpaceId() const { return _dockSpaceId; }
+        [[nodiscard]] Backend GetBackend() const { return _backend; }
+        [[nodiscard]] Allocator GetAllocator() const { return _allocator; }
+        /// Statistics of the pool allocator (null w/ the System one)
+        [[nodiscard]] const PoolAllocator::Stats* GetAllocatorStats() const;
+        /// Last rasterized frame of the Software backend (premultiplied SoftRenderer::PixelFormat), null otherwise
+        [[nodiscard]] SDL_Surface* GetSoftwareSurface() const { return _softSurface.get(); }
 
     private:
         void LoadFonts();
         bool LoadFont(const Fs::Path& fontPath, const char* fontName, float fontSize);
+        void RenderSoftware(ImDrawData* drawData);
 
         SDL_Window* _window;
         SDL_Renderer* _renderer;
         std::shared_ptr<Fs::Drive> _drive;
+        std::unique_ptr<Sdl::RenderState> _ownRenderState;
+        Sdl::RenderState* _renderState;
+        Backend _backend;
+        Allocator _allocator;
+
+        // Software backend
+        std::unique_ptr<SoftRenderer> _softRenderer;
+        Sdl::Surface _softSurface;
+        Sdl::Texture _softTexture;
 
         ImGuiContext* _context{};
         ImGuiIO* _io{};
@@ -0,0 +1,124 @@
+#include "PoolAllocator.h"
+#include "Sdl/Stats/AllocTracker.h"
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+
+namespace Im
+{
+    // Block sizes include the header: 16-byte steps up to 128 (8 classes), then 4 classes per power of two
+    uint32_t PoolAllocator::ClassIndex(size_t blockSize)
+    {
+        if (blockSize <= 128) {
+            return static_cast<uint32_t>((blockSize - 1) / 16);
+        }
+        const auto log = std::bit_width(blockSize - 1) - 1; // 7 for 129..256
+        const auto sub = ((blockSize - 1) >> (log - 2)) & 3;
+        return static_cast<uint32_t>(8 + (log - 7) * 4 + sub);
+    }
+
+    size_t PoolAllocator::ClassSize(uint32_t index)
+    {
+        if (index < 8) {
+            return (index + 1) * 16;
+        }
+        const auto log = (index - 8) / 4 + 7;
+        const auto sub = (index - 8) % 4;
+        return (size_t{1} << log) + (sub + 1) * (size_t{1} << (log - 2));
+    }
+
+    PoolAllocator::~PoolAllocator()
+    {
+        for (auto* slab : _slabs) {
+            std::free(slab);
+            Sdl::Stats::AllocTracker::OnFree();
+        }
+    }
+
+    void* PoolAllocator::Allocate(size_t size)
+    {
+        ++_stats.allocations;
+        _stats.liveBytes += size;
+        _stats.peakLiveBytes = std::max(_stats.peakLiveBytes, _stats.liveBytes);
+
+        Header* header;
+        if (size > MaxPooledSize) {
+            header = static_cast<Header*>(std::malloc(sizeof(Header) + size));
+            if (!header) {
+                return nullptr;
+            }
+            Sdl::Stats::AllocTracker::OnAlloc(sizeof(Header) + size);
+            ++_stats.largeAllocations;
+            _stats.largeBytes += size;
+            header->sizeClass = LargeClass;
+        } else {
+            const auto index = ClassIndex(sizeof(Header) + std::max<size_t>(size, 1));
+            if (!_freeLists[index]) {
+                Refill(index);
+                if (!_freeLists[index]) {
+                    return nullptr;
+                }
+            }
+            auto* block = _freeLists[index];
+            _freeLists[index] = block->next;
+            header = reinterpret_cast<Header*>(block);
+            header->sizeClass = index;
+        }
+        header->size = size;
+        return header + 1;
+    }
+
+    void PoolAllocator::Free(void* ptr)
+    {
+        if (!ptr) {
+            return;
+        }
+        auto* header = static_cast<Header*>(ptr) - 1;
+        ++_stats.frees;
+        _stats.liveBytes -= header->size;
+        if (header->sizeClass == LargeClass) {
+            _stats.largeBytes -= header->size;
+            std::free(header);
+            Sdl::Stats::AllocTracker::OnFree();
+            return;
+        }
+        auto* block = reinterpret_cast<FreeBlock*>(header);
+        block->next = _freeLists[header->sizeClass];
+        _freeLists[header->sizeClass] = block;
+    }
+
+    void PoolAllocator::Refill(uint32_t index)
+    {
+        auto* slab = static_cast<std::byte*>(std::malloc(SlabSize));
+        if (!slab) {
+            return;
+        }
+        Sdl::Stats::AllocTracker::OnAlloc(SlabSize);
+        _slabs.push_back(slab);
+        _stats.slabBytes += SlabSize;
+
+        // pushed in reverse, so blocks are handed out in address order
+        const auto blockSize = ClassSize(index);
+        for (auto offset = (SlabSize / blockSize) * blockSize; offset >= blockSize; offset -= blockSize) {
+            auto* block = reinterpret_cast<FreeBlock*>(slab + offset - blockSize);
+            block->next = _freeLists[index];
+            _freeLists[index] = block;
+        }
+    }
+
+    PoolAllocator& PoolAllocator::Shared()
+    {
+        static auto* instance = new PoolAllocator(); // intentionally leaked
+        return *instance;
+    }
+
+    void* PoolAllocator::ImGuiAlloc(size_t size, void* userData)
+    {
+        return static_cast<PoolAllocator*>(userData)->Allocate(size);
+    }
+
+    void PoolAllocator::ImGuiFree(void* ptr, void* userData)
+    {
+        static_cast<PoolAllocator*>(userData)->Free(ptr);
+    }
+}
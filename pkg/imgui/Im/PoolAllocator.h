@@ -0,0 +1,76 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Im
+{
+    /// Size-class pool allocator for ImGui (installed by Deputy through ImGui::SetAllocatorFunctions).
+    /// Requests up to MaxPooledSize are served from per-class free lists carved out of SlabSize blocks, larger ones
+    /// go to malloc. Freed blocks return to their class list and slabs are kept, so ImGui's churn of small buffers
+    /// (ImVector growth, draw list and window buffers) doesn't reach the system heap: memory stays at the peak
+    /// working set instead of fragmenting over a long uptime.
+    /// Not thread-safe (ImGui contexts are used from one thread). Every block has a 16-byte header with its class,
+    /// so frees don't need the size.
+    class PoolAllocator
+    {
+    public:
+        static constexpr size_t SlabSize = size_t{64} * 1024;
+        static constexpr size_t MaxPooledSize = size_t{16} * 1024 - 16; // payload of the largest class
+
+        struct Stats
+        {
+            uint64_t allocations = 0;
+            uint64_t frees = 0;
+            uint64_t largeAllocations = 0; // passed to malloc (over MaxPooledSize)
+            size_t liveBytes = 0; // requested by live allocations
+            size_t peakLiveBytes = 0;
+            size_t slabBytes = 0; // reserved for the pools
+            size_t largeBytes = 0; // live large allocations
+        };
+
+        PoolAllocator() = default;
+        ~PoolAllocator();
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        void* Allocate(size_t size);
+        void Free(void* ptr);
+
+        [[nodiscard]] const Stats& GetStats() const { return _stats; }
+
+        /// Process-lifetime instance for ImGui: never destroyed, as static ImVector objects (e.g. in the demo window)
+        /// free their buffers during static destruction
+        static PoolAllocator& Shared();
+        /// ImGuiMemAllocFunc/ImGuiMemFreeFunc w/ the allocator as user data
+        static void* ImGuiAlloc(size_t size, void* userData);
+        static void ImGuiFree(void* ptr, void* userData);
+
+    private:
+        struct alignas(16) Header
+        {
+            size_t size; // requested
+            uint32_t sizeClass; // LargeClass for malloc'ed blocks
+        };
+        static_assert(sizeof(Header) == 16);
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        static constexpr size_t ClassCount = 8 + 7 * 4; // 16-byte steps up to 128, then 4 per octave up to 16 KiB
+        static constexpr uint32_t LargeClass = UINT32_MAX;
+
+        static uint32_t ClassIndex(size_t blockSize);
+        static size_t ClassSize(uint32_t index);
+
+        std::array<FreeBlock*, ClassCount> _freeLists{};
+        std::vector<void*> _slabs;
+        Stats _stats;
+
+        void Refill(uint32_t index);
+    };
+}
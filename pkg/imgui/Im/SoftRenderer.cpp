@@ -0,0 +1,509 @@
+#include "SoftRenderer.h"
+#include "Log/Log.h"
+#include <SDL3/SDL_error.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Im
+{
+    static Log::Logger _logger{"Im.SoftRenderer"};
+
+    static constexpr int SubPixelBits = 4;
+    static constexpr int32_t SubPixelOne = 1 << SubPixelBits;
+    static constexpr int32_t SubPixelHalf = SubPixelOne / 2;
+    static constexpr float CoordLimit = float(1 << 26); // subpixel units, keeps the edge products in int64
+    static constexpr size_t MaxDefaultThreads = 8;
+
+    static int64_t FloorDiv(int64_t a, int64_t b) // b > 0
+    {
+        const auto q = a / b;
+        return (a % b != 0 && a < 0) ? q - 1 : q;
+    }
+
+    static int64_t CeilDiv(int64_t a, int64_t b) // b > 0
+    {
+        return -FloorDiv(-a, b);
+    }
+
+    // same NaN/order semantics as _mm_max_ps/_mm_min_ps, so both setup paths produce identical coordinates
+    static float MaxPs(float a, float b) { return a > b ? a : b; }
+    static float MinPs(float a, float b) { return a < b ? a : b; }
+
+    static ImU32 Div255(ImU32 x)
+    {
+        x += 128;
+        return (x + (x >> 8)) >> 8;
+    }
+
+    static ImU32 Modulate(ImU32 a, ImU32 b)
+    {
+        ImU32 out = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            out |= Div255(((a >> shift) & 0xFF) * ((b >> shift) & 0xFF)) << shift;
+        }
+        return out;
+    }
+
+    /// "Over" w/ a single rounding per channel: rgb = s*a + d*(1-a), alpha = a + d*(1-a)
+    static ImU32 Blend(ImU32 src, ImU32 dst)
+    {
+        const ImU32 alpha = (src >> IM_COL32_A_SHIFT) & 0xFF;
+        const ImU32 inverse = 255 - alpha;
+        src |= 0xFFu << IM_COL32_A_SHIFT;
+        ImU32 out = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            out |= Div255(((src >> shift) & 0xFF) * alpha + ((dst >> shift) & 0xFF) * inverse) << shift;
+        }
+        return out;
+    }
+
+    static void BlendSpan(ImU32* dst, int count, ImU32 color)
+    {
+        const ImU32 alpha = (color >> IM_COL32_A_SHIFT) & 0xFF;
+        if (alpha == 0) {
+            return;
+        }
+        if (alpha == 255) {
+            std::fill_n(dst, count, color);
+            return;
+        }
+#if defined(__SSE2__)
+        // same arithmetic as Blend on 16-bit lanes, 4 pixels per step
+        const ImU32 opaque = color | (0xFFu << IM_COL32_A_SHIFT);
+        const auto term = [&](int byte) { return static_cast<short>(((opaque >> (byte * 8)) & 0xFF) * alpha); };
+        const __m128i source = _mm_setr_epi16(term(0), term(1), term(2), term(3), term(0), term(1), term(2), term(3));
+        const __m128i inverse = _mm_set1_epi16(static_cast<short>(255 - alpha));
+        const __m128i round = _mm_set1_epi16(128);
+        const __m128i zero = _mm_setzero_si128();
+        const auto blend = [&](__m128i d) {
+            const __m128i t = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(d, inverse), source), round);
+            return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        };
+        for (; count >= 4; count -= 4, dst += 4) {
+            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst));
+            const __m128i lo = blend(_mm_unpacklo_epi8(d, zero));
+            const __m128i hi = blend(_mm_unpackhi_epi8(d, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(lo, hi));
+        }
+#endif
+        for (; count > 0; --count, ++dst) {
+            *dst = Blend(color, *dst);
+        }
+    }
+
+    void SoftRenderer::TransformVertices(const ImDrawVert* src, int count, ImVec2 origin, ImVec2 scale, std::vector<Vertex>& out)
+    {
+        const float scaleX = scale.x * SubPixelOne;
+        const float scaleY = scale.y * SubPixelOne;
+        const auto base = out.size();
+        out.resize(base + count);
+        auto* dst = out.data() + base;
+        for (int i = 0; i < count; ++i) {
+            dst[i].u = src[i].uv.x;
+            dst[i].v = src[i].uv.y;
+            dst[i].col = src[i].col;
+        }
+
+        int i = 0;
+#if defined(__SSE2__)
+        const __m128 offset = _mm_setr_ps(origin.x, origin.y, origin.x, origin.y);
+        const __m128 factor = _mm_setr_ps(scaleX, scaleY, scaleX, scaleY);
+        const __m128 low = _mm_set1_ps(-CoordLimit);
+        const __m128 high = _mm_set1_ps(CoordLimit);
+        for (; i + 2 <= count; i += 2) {
+            __m128 p = _mm_setr_ps(src[i].pos.x, src[i].pos.y, src[i + 1].pos.x, src[i + 1].pos.y);
+            p = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(p, offset), factor), low), high);
+            alignas(16) int32_t xy[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(xy), _mm_cvtps_epi32(p));
+            dst[i].x = xy[0];
+            dst[i].y = xy[1];
+            dst[i + 1].x = xy[2];
+            dst[i + 1].y = xy[3];
+        }
+#endif
+        for (; i < count; ++i) {
+            dst[i].x = static_cast<int32_t>(std::lrint(MinPs(MaxPs((src[i].pos.x - origin.x) * scaleX, -CoordLimit), CoordLimit)));
+            dst[i].y = static_cast<int32_t>(std::lrint(MinPs(MaxPs((src[i].pos.y - origin.y) * scaleY, -CoordLimit), CoordLimit)));
+        }
+    }
+
+    static ImU32 Sample(const std::vector<ImU32>* pixels, int width, int height, float u, float v)
+    {
+        if (!pixels) {
+            return IM_COL32_WHITE;
+        }
+        auto x = u * static_cast<float>(width);
+        auto y = v * static_cast<float>(height);
+        x = x >= 0.0f ? std::min(x, static_cast<float>(width - 1)) : 0.0f; // NaN goes to 0 too
+        y = y >= 0.0f ? std::min(y, static_cast<float>(height - 1)) : 0.0f;
+        return (*pixels)[static_cast<size_t>(static_cast<int>(y)) * width + static_cast<int>(x)];
+    }
+
+    SoftRenderer::SoftRenderer()
+        : SoftRenderer(Config{})
+    {}
+
+    SoftRenderer::SoftRenderer(Config config)
+        : _config(config)
+    {
+        _config.TileHeight = std::max(_config.TileHeight, 1);
+        auto threadCount = _config.ThreadCount;
+        if (threadCount == 0) {
+            threadCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MaxDefaultThreads);
+        }
+        for (size_t i = 1; i < threadCount; ++i) {
+            _workers.emplace_back([this] { RunWorker(); });
+        }
+        _logger.Debug("threads: {}", threadCount);
+    }
+
+    SoftRenderer::~SoftRenderer()
+    {
+        {
+            std::lock_guard lock{_mutex};
+            _stopping = true;
+        }
+        _wakeup.notify_all();
+        for (auto& worker : _workers) {
+            worker.join();
+        }
+    }
+
+    void SoftRenderer::Init()
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        io.BackendRendererUserData = this;
+        io.BackendRendererName = "tx_soft_renderer";
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset; // 32-bit vertex indexing
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures; // ImDrawData::Textures updates
+    }
+
+    void SoftRenderer::Shutdown()
+    {
+        for (ImTextureData* tex : ImGui::GetPlatformIO().Textures) {
+            if (tex->RefCount == 1) {
+                tex->SetTexID(ImTextureID_Invalid);
+                tex->SetStatus(ImTextureStatus_Destroyed);
+            }
+        }
+        _textures.clear();
+
+        ImGuiIO& io = ImGui::GetIO();
+        io.BackendRendererUserData = nullptr;
+        io.BackendRendererName = nullptr;
+        io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    }
+
+    void SoftRenderer::UpdateTexture(ImTextureData* tex)
+    {
+        const auto copy = [tex](Texture& texture, int x, int y, int w, int h) {
+            for (int row = y; row < y + h; ++row) {
+                const auto* src = static_cast<const unsigned char*>(tex->GetPixelsAt(x, row));
+                auto* dst = texture.pixels.data() + static_cast<size_t>(row) * texture.width + x;
+                if (tex->Format == ImTextureFormat_RGBA32) {
+                    std::memcpy(dst, src, static_cast<size_t>(w) * sizeof(ImU32));
+                } else {
+                    for (int i = 0; i < w; ++i) {
+                        dst[i] = IM_COL32(255, 255, 255, src[i]);
+                    }
+                }
+            }
+        };
+
+        if (tex->Status == ImTextureStatus_WantCreate) {
+            auto texture = std::make_unique<Texture>();
+            texture->width = tex->Width;
+            texture->height = tex->Height;
+            texture->pixels.resize(static_cast<size_t>(tex->Width) * tex->Height);
+            copy(*texture, 0, 0, tex->Width, tex->Height);
+            const auto id = static_cast<ImTextureID>(reinterpret_cast<intptr_t>(texture.get()));
+            _textures[id] = std::move(texture);
+            tex->SetTexID(id);
+            tex->SetStatus(ImTextureStatus_OK);
+            _stats.textureUploads++;
+        } else if (tex->Status == ImTextureStatus_WantUpdates) {
+            if (auto it = _textures.find(tex->GetTexID()); it != _textures.end()) {
+                for (const ImTextureRect& rect : tex->Updates) {
+                    copy(*it->second, rect.x, rect.y, rect.w, rect.h);
+                }
+                _stats.textureUploads++;
+            }
+            tex->SetStatus(ImTextureStatus_OK);
+        } else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0) {
+            _textures.erase(tex->GetTexID());
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+    }
+
+    void SoftRenderer::RenderDrawData(ImDrawData* drawData, SDL_Surface* target)
+    {
+        if (drawData->Textures) {
+            for (ImTextureData* tex : *drawData->Textures) {
+                if (tex->Status != ImTextureStatus_OK) {
+                    UpdateTexture(tex);
+                }
+            }
+        }
+
+        if (!target || target->format != PixelFormat) {
+            _logger.Error("target: unsupported surface");
+            return;
+        }
+        if (!SDL_LockSurface(target)) {
+            _logger.Error("SDL_LockSurface: {}", SDL_GetError());
+            return;
+        }
+
+        _target = target;
+        SetupTriangles(drawData);
+        _tileCount = (target->h + _config.TileHeight - 1) / _config.TileHeight;
+        if (!_triangles.empty()) {
+            RasterTiles();
+        }
+        _target = nullptr;
+
+        SDL_UnlockSurface(target);
+    }
+
+    void SoftRenderer::SetupTriangles(ImDrawData* drawData)
+    {
+        _vertices.clear();
+        _triangles.clear();
+
+        const auto origin = drawData->DisplayPos;
+        const auto scale = drawData->FramebufferScale;
+        for (ImDrawList* drawList : drawData->CmdLists) {
+            const auto listBase = static_cast<uint32_t>(_vertices.size());
+            TransformVertices(drawList->VtxBuffer.Data, drawList->VtxBuffer.Size, origin, scale, _vertices);
+
+            for (const ImDrawCmd& cmd : drawList->CmdBuffer) {
+                if (cmd.UserCallback) {
+                    // there's no render state to reset, others run before the rasterization
+                    if (cmd.UserCallback != ImDrawCallback_ResetRenderState) {
+                        cmd.UserCallback(drawList, &cmd);
+                    }
+                    continue;
+                }
+
+                const int clipX0 = std::max(0, static_cast<int>((cmd.ClipRect.x - origin.x) * scale.x));
+                const int clipY0 = std::max(0, static_cast<int>((cmd.ClipRect.y - origin.y) * scale.y));
+                const int clipX1 = std::min(_target->w, static_cast<int>((cmd.ClipRect.z - origin.x) * scale.x));
+                const int clipY1 = std::min(_target->h, static_cast<int>((cmd.ClipRect.w - origin.y) * scale.y));
+                if (clipX0 >= clipX1 || clipY0 >= clipY1) {
+                    continue;
+                }
+
+                // textures of other backends aren't readable here, they're drawn as white
+                const Texture* texture{};
+                if (auto it = _textures.find(cmd.GetTexID()); it != _textures.end()) {
+                    texture = it->second.get();
+                }
+
+                const auto* indices = drawList->IdxBuffer.Data + cmd.IdxOffset;
+                const auto vertexBase = listBase + cmd.VtxOffset;
+                for (unsigned int i = 0; i + 2 < cmd.ElemCount; i += 3) {
+                    Triangle tri{};
+                    tri.v[0] = vertexBase + indices[i];
+                    tri.v[1] = vertexBase + indices[i + 1];
+                    tri.v[2] = vertexBase + indices[i + 2];
+                    const auto& a = _vertices[tri.v[0]];
+                    const auto& b = _vertices[tri.v[1]];
+                    const auto& c = _vertices[tri.v[2]];
+
+                    tri.area = int64_t{b.x - a.x} * (c.y - a.y) - int64_t{c.x - a.x} * (b.y - a.y);
+                    if (tri.area == 0) {
+                        continue;
+                    }
+                    if (tri.area < 0) {
+                        std::swap(tri.v[1], tri.v[2]);
+                        tri.area = -tri.area;
+                    }
+
+                    // pixels w/ centers inside the bounds
+                    const auto minX = std::min({a.x, b.x, c.x});
+                    const auto minY = std::min({a.y, b.y, c.y});
+                    const auto maxX = std::max({a.x, b.x, c.x});
+                    const auto maxY = std::max({a.y, b.y, c.y});
+                    tri.minX = static_cast<int>(std::max<int64_t>(CeilDiv(minX - SubPixelHalf, SubPixelOne), clipX0));
+                    tri.minY = static_cast<int>(std::max<int64_t>(CeilDiv(minY - SubPixelHalf, SubPixelOne), clipY0));
+                    tri.maxX = static_cast<int>(std::min<int64_t>(FloorDiv(maxX - SubPixelHalf, SubPixelOne) + 1, clipX1));
+                    tri.maxY = static_cast<int>(std::min<int64_t>(FloorDiv(maxY - SubPixelHalf, SubPixelOne) + 1, clipY1));
+                    if (tri.minX >= tri.maxX || tri.minY >= tri.maxY) {
+                        continue;
+                    }
+
+                    tri.texture = texture;
+                    tri.flat = a.col == b.col && a.col == c.col && a.u == b.u && a.u == c.u && a.v == b.v && a.v == c.v;
+                    if (tri.flat) {
+                        tri.flatColor = Modulate(a.col, texture ? Sample(&texture->pixels, texture->width, texture->height, a.u, a.v) : IM_COL32_WHITE);
+                        if (((tri.flatColor >> IM_COL32_A_SHIFT) & 0xFF) == 0) {
+                            continue;
+                        }
+                        _stats.flatTriangles++;
+                    }
+                    _triangles.push_back(tri);
+                }
+            }
+        }
+        _stats.triangles += _triangles.size();
+    }
+
+    void SoftRenderer::RunWorker()
+    {
+        uint64_t generation = 0;
+        for (;;) {
+            {
+                std::unique_lock lock{_mutex};
+                _wakeup.wait(lock, [&] { return _stopping || _generation != generation; });
+                if (_stopping) {
+                    return;
+                }
+                generation = _generation;
+            }
+
+            for (int tile; (tile = _nextTile.fetch_add(1, std::memory_order_relaxed)) < _tileCount;) {
+                RasterTile(tile);
+            }
+
+            std::lock_guard lock{_mutex};
+            if (--_busy == 0) {
+                _done.notify_one();
+            }
+        }
+    }
+
+    void SoftRenderer::RasterTiles()
+    {
+        _nextTile.store(0, std::memory_order_relaxed);
+        if (!_workers.empty()) {
+            {
+                std::lock_guard lock{_mutex};
+                ++_generation;
+                _busy = _workers.size();
+            }
+            _wakeup.notify_all();
+        }
+
+        for (int tile; (tile = _nextTile.fetch_add(1, std::memory_order_relaxed)) < _tileCount;) {
+            RasterTile(tile);
+        }
+
+        if (!_workers.empty()) {
+            std::unique_lock lock{_mutex};
+            _done.wait(lock, [this] { return _busy == 0; });
+        }
+    }
+
+    void SoftRenderer::RasterTile(int tile)
+    {
+        // every tile walks the triangles in submission order, so its pixels don't depend on the scheduling
+        const int rowBegin = tile * _config.TileHeight;
+        const int rowEnd = std::min(rowBegin + _config.TileHeight, _target->h);
+        for (const auto& triangle : _triangles) {
+            if (triangle.maxY <= rowBegin || triangle.minY >= rowEnd) {
+                continue;
+            }
+            RasterTriangle(triangle, std::max(triangle.minY, rowBegin), std::min(triangle.maxY, rowEnd));
+        }
+    }
+
+    void SoftRenderer::RasterTriangle(const Triangle& triangle, int rowBegin, int rowEnd) const
+    {
+        const Vertex* v[3] = {&_vertices[triangle.v[0]], &_vertices[triangle.v[1]], &_vertices[triangle.v[2]]};
+
+        // edge i is opposite to vertex i: E(x, y) = a*x + b*y + c, positive inside, equals the area at the vertex;
+        // shared edges are owned by one side only (a > 0, or a == 0 && b > 0)
+        struct Edge
+        {
+            int64_t a, b, c, bias;
+        } edges[3];
+        for (int i = 0; i < 3; ++i) {
+            const auto& from = *v[(i + 1) % 3];
+            const auto& to = *v[(i + 2) % 3];
+            auto& edge = edges[i];
+            edge.a = int64_t{from.y} - to.y;
+            edge.b = int64_t{to.x} - from.x;
+            edge.c = (int64_t{to.y} - from.y) * from.x - (int64_t{to.x} - from.x) * from.y;
+            edge.bias = (edge.a > 0 || (edge.a == 0 && edge.b > 0)) ? 0 : 1;
+        }
+
+        // per-vertex attributes of the interpolated path
+        const bool constantColor = triangle.flat || (v[0]->col == v[1]->col && v[0]->col == v[2]->col);
+        float colors[3][4]{};
+        if (!constantColor) {
+            for (int i = 0; i < 3; ++i) {
+                for (int channel = 0; channel < 4; ++channel) {
+                    colors[i][channel] = static_cast<float>((v[i]->col >> (channel * 8)) & 0xFF);
+                }
+            }
+        }
+        const auto* texture = triangle.texture;
+        const auto* texels = texture ? &texture->pixels : nullptr;
+        const int texWidth = texture ? texture->width : 0;
+        const int texHeight = texture ? texture->height : 0;
+        const float inverseArea = 1.0f / static_cast<float>(triangle.area);
+
+        auto* pixels = static_cast<uint8_t*>(_target->pixels);
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const int64_t py = int64_t{y} * SubPixelOne + SubPixelHalf;
+
+            // span where all edge functions pass: E(x) = base + step * x at pixel centers
+            int64_t spanBegin = triangle.minX;
+            int64_t spanEnd = triangle.maxX;
+            int64_t base[3];
+            int64_t step[3];
+            for (int i = 0; i < 3; ++i) {
+                const auto& edge = edges[i];
+                base[i] = edge.a * SubPixelHalf + edge.b * py + edge.c;
+                step[i] = edge.a * SubPixelOne;
+                if (step[i] > 0) {
+                    spanBegin = std::max(spanBegin, CeilDiv(edge.bias - base[i], step[i]));
+                } else if (step[i] < 0) {
+                    spanEnd = std::min(spanEnd, FloorDiv(base[i] - edge.bias, -step[i]) + 1);
+                } else if (base[i] < edge.bias) {
+                    spanEnd = spanBegin;
+                }
+            }
+            if (spanBegin >= spanEnd) {
+                continue;
+            }
+
+            auto* row = reinterpret_cast<ImU32*>(pixels + static_cast<size_t>(y) * _target->pitch);
+            const int x0 = static_cast<int>(spanBegin);
+            const int x1 = static_cast<int>(spanEnd);
+            if (triangle.flat) {
+                BlendSpan(row + x0, x1 - x0, triangle.flatColor);
+                continue;
+            }
+
+            for (int x = x0; x < x1; ++x) {
+                const float l0 = static_cast<float>(base[0] + step[0] * x) * inverseArea;
+                const float l1 = static_cast<float>(base[1] + step[1] * x) * inverseArea;
+                const float l2 = static_cast<float>(base[2] + step[2] * x) * inverseArea;
+
+                ImU32 color = v[0]->col;
+                if (!constantColor) {
+                    color = 0;
+                    for (int channel = 0; channel < 4; ++channel) {
+                        const auto value = l0 * colors[0][channel] + l1 * colors[1][channel] + l2 * colors[2][channel];
+                        color |= static_cast<ImU32>(std::clamp(value, 0.0f, 255.0f) + 0.5f) << (channel * 8);
+                    }
+                }
+                if (texels) {
+                    const auto u = l0 * v[0]->u + l1 * v[1]->u + l2 * v[2]->u;
+                    const auto w = l0 * v[0]->v + l1 * v[1]->v + l2 * v[2]->v;
+                    color = Modulate(color, Sample(texels, texWidth, texHeight, u, w));
+                }
+                if ((color >> IM_COL32_A_SHIFT) & 0xFF) {
+                    row[x] = Blend(color, row[x]);
+                }
+            }
+        }
+    }
+}
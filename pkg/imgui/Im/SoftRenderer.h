@@ -0,0 +1,110 @@
+#pragma once
+#include "imgui.h"
+#include <SDL3/SDL_surface.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Im
+{
+    /// Software ImGui renderer backend: rasterizes ImDrawData straight into an SDL_Surface on the CPU.
+    /// Triangles are set up once per frame, then the target is split into horizontal tiles rasterized
+    /// in parallel (span filling w/ alpha blending, SSE2 for flat spans where available).
+    /// Output is bit-exact for any thread count, so headless runs can be used for pixel regression tests
+    /// and UI-heavy benchmarks independent of GPU drivers. The target holds premultiplied colors
+    /// (blended over a transparent clear), composite it with SDL_BLENDMODE_BLEND_PREMULTIPLIED.
+    class SoftRenderer
+    {
+    public:
+        /// Target surface format: packed the same way as ImU32 colors
+        static constexpr SDL_PixelFormat PixelFormat = IM_COL32_R_SHIFT == 0 ? SDL_PIXELFORMAT_ABGR8888 : SDL_PIXELFORMAT_ARGB8888;
+
+        struct Config
+        {
+            size_t ThreadCount = 0; // rasterizing threads including the caller (0 - hardware concurrency, up to 8)
+            int TileHeight = 32; // rows per tile
+        };
+
+        struct Stats
+        {
+            uint64_t triangles = 0;
+            uint64_t flatTriangles = 0; // constant color, filled w/o interpolation
+            uint64_t textureUploads = 0;
+        };
+
+        SoftRenderer();
+        explicit SoftRenderer(Config config);
+        ~SoftRenderer();
+
+        SoftRenderer(const SoftRenderer&) = delete;
+        SoftRenderer& operator=(const SoftRenderer&) = delete;
+
+        /// Register as the renderer backend of the current ImGui context
+        void Init();
+        /// Destroy the textures and unregister (current ImGui context)
+        void Shutdown();
+
+        /// Rasterize the draw data over the target contents (PixelFormat, framebuffer sized)
+        void RenderDrawData(ImDrawData* drawData, SDL_Surface* target);
+
+        [[nodiscard]] const Stats& GetStats() const { return _stats; }
+
+    private:
+        struct Texture
+        {
+            int width{};
+            int height{};
+            std::vector<ImU32> pixels; // Alpha8 is expanded to white
+        };
+
+        struct Vertex
+        {
+            int32_t x, y; // target pixels w/ SubPixelBits fraction
+            float u, v;
+            ImU32 col;
+        };
+
+        struct Triangle
+        {
+            uint32_t v[3]; // counter-clockwise on the screen (positive area)
+            int64_t area; // doubled, in subpixel units
+            int minX, minY, maxX, maxY; // covered pixels (exclusive max) within the clip rect
+            const Texture* texture;
+            ImU32 flatColor;
+            bool flat;
+        };
+
+        Config _config;
+        Stats _stats;
+        std::unordered_map<ImTextureID, std::unique_ptr<Texture>> _textures;
+
+        // Frame
+        std::vector<Vertex> _vertices;
+        std::vector<Triangle> _triangles;
+        SDL_Surface* _target{};
+        int _tileCount{};
+        std::atomic<int> _nextTile{};
+
+        // Workers
+        std::mutex _mutex;
+        std::condition_variable _wakeup;
+        std::condition_variable _done;
+        uint64_t _generation{};
+        size_t _busy{};
+        bool _stopping = false;
+        std::vector<std::thread> _workers;
+
+        static void TransformVertices(const ImDrawVert* src, int count, ImVec2 origin, ImVec2 scale, std::vector<Vertex>& out);
+        void UpdateTexture(ImTextureData* tex);
+        void SetupTriangles(ImDrawData* drawData);
+        void RunWorker();
+        void RasterTiles();
+        void RasterTile(int tile);
+        void RasterTriangle(const Triangle& triangle, int rowBegin, int rowEnd) const;
+    };
+}
@@ -0,0 +1,37 @@
+#include "AsioPump.h"
+#include "Sdl/Loop/Sdl3Runner.h"
+
+namespace Sdl::Loop
+{
+    void AsioPump::Executor::WakeLoop()
+    {
+        Sdl3Runner::Wake();
+    }
+
+    AsioPump::AsioPump(boost::asio::io_context& context)
+        : _context(context)
+    {}
+
+    AsioPump::Executor AsioPump::GetExecutor() const
+    {
+        return Executor{_context.get_executor()};
+    }
+
+    bool AsioPump::Poll(Clock::time_point deadline)
+    {
+        if (_context.stopped()) {
+            _context.restart(); // ran out of work on the previous poll
+        }
+        while (Clock::now() < deadline) {
+            if (_context.poll_one() == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool AsioPump::HasPendingWork() const
+    {
+        return !_context.stopped();
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "Sdl/Loop/WorkPump.h"
+#include <boost/asio/execution.hpp>
+#include <boost/asio/io_context.hpp>
+#include <utility>
+
+namespace Sdl::Loop
+{
+    /// Runs the ready handlers of an asio io_context on the Sdl3Runner loop thread (Options::Pump):
+    /// poll_one until drained or the frame budget is spent, the rest continues on the next frame.
+    /// Handlers posted through GetExecutor() from other threads wake the loop from the idle wait (WaitEvents mode),
+    /// timers and sockets are only checked by polling (so the idle wait is bounded while the context has work).
+    /// The context is restarted when it stopped for lack of work, so later work keeps being pumped.
+    class AsioPump final : public WorkPump
+    {
+    public:
+        /// io_context executor that wakes the runner loop when work is submitted outside of it
+        class Executor
+        {
+            using Inner = decltype(boost::asio::require(
+                std::declval<boost::asio::io_context::executor_type>(), boost::asio::execution::blocking.never));
+
+        public:
+            explicit Executor(const boost::asio::io_context::executor_type& inner) noexcept
+                : _inner(boost::asio::require(inner, boost::asio::execution::blocking.never))
+            {}
+
+            template<typename Function>
+            void execute(Function&& function) const
+            {
+                const auto wake = !_inner.running_in_this_thread();
+                _inner.execute(std::forward<Function>(function));
+                if (wake) {
+                    WakeLoop();
+                }
+            }
+
+            [[nodiscard]] boost::asio::io_context& query(boost::asio::execution::context_t) const noexcept
+            {
+                return boost::asio::query(_inner, boost::asio::execution::context);
+            }
+
+            static constexpr boost::asio::execution::blocking_t query(boost::asio::execution::blocking_t) noexcept
+            {
+                return boost::asio::execution::blocking.never;
+            }
+
+            [[nodiscard]] Executor require(boost::asio::execution::blocking_t::never_t) const noexcept { return *this; }
+
+            friend bool operator==(const Executor& a, const Executor& b) noexcept { return a._inner == b._inner; }
+            friend bool operator!=(const Executor& a, const Executor& b) noexcept { return a._inner != b._inner; }
+
+        private:
+            Inner _inner;
+
+            static void WakeLoop();
+        };
+
+        explicit AsioPump(boost::asio::io_context& context);
+
+        /// Executor for work that should wake the idle loop (co_spawn, timers, cross-thread posts)
+        [[nodiscard]] Executor GetExecutor() const;
+        [[nodiscard]] boost::asio::io_context& GetContext() const { return _context; }
+
+        bool Poll(Clock::time_point deadline) override;
+        [[nodiscard]] bool HasPendingWork() const override;
+
+    private:
+        boost::asio::io_context& _context;
+    };
+}
@@ -0,0 +1,78 @@
+#include "EventHub.h"
+#include <algorithm>
+#include <bit>
+
+namespace Sdl::Loop
+{
+    bool EventSubscription::Filter::Matches(const SDL_Event& event) const
+    {
+        if (event.type < firstType || event.type > lastType) {
+            return false;
+        }
+        return !window || SDL_GetWindowFromEvent(&event) == window;
+    }
+
+    EventSubscription::EventSubscription(EventHub& hub, Filter filter, size_t capacity)
+        : _hub(hub)
+        , _filter(filter)
+        , _ring(std::bit_ceil(std::max<size_t>(capacity, 1)))
+    {
+        _hub.Add(*this);
+    }
+
+    EventSubscription::~EventSubscription()
+    {
+        _hub.Remove(*this);
+    }
+
+    bool EventSubscription::TryPop(SDL_Event& event)
+    {
+        if (_count == 0) {
+            return false;
+        }
+        event = _ring[_head];
+        _head = (_head + 1) & (_ring.size() - 1);
+        --_count;
+        return true;
+    }
+
+    void EventSubscription::Clear()
+    {
+        _head = 0;
+        _count = 0;
+    }
+
+    void EventSubscription::Push(const SDL_Event& event)
+    {
+        const auto mask = _ring.size() - 1;
+        if (_count == _ring.size()) {
+            _head = (_head + 1) & mask; // drop the oldest
+            --_count;
+            ++_dropped;
+        }
+        _ring[(_head + _count) & mask] = event;
+        ++_count;
+        if (_notify) {
+            _notify(_notifyContext);
+        }
+    }
+
+    void EventHub::DispatchToSubscriptions(const SDL_Event& event)
+    {
+        for (auto* subscription : _subscriptions) {
+            if (subscription->_filter.Matches(event)) {
+                subscription->Push(event);
+            }
+        }
+    }
+
+    void EventHub::Add(EventSubscription& subscription)
+    {
+        _subscriptions.push_back(&subscription);
+    }
+
+    void EventHub::Remove(EventSubscription& subscription)
+    {
+        std::erase(_subscriptions, &subscription);
+    }
+}
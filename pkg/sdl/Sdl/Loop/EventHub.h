@@ -0,0 +1,96 @@
+#pragma once
+#include <SDL3/SDL_events.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Sdl::Loop
+{
+    class EventHub;
+
+    /// Events of the runner matching a filter, queued in a fixed ring (sized on construction, no allocation per event;
+    /// the oldest event is dropped when it's full). Lives on the loop thread and must not outlive the hub.
+    /// Consumers poll TryPop or get notified on push (see EventStream of //pkg/sdl:asio for awaitables).
+    class EventSubscription
+    {
+    public:
+        static constexpr size_t DefaultCapacity = 64;
+
+        struct Filter
+        {
+            Uint32 firstType = SDL_EVENT_FIRST; // inclusive type range
+            Uint32 lastType = SDL_EVENT_LAST;
+            SDL_Window* window{}; // only events of the window (any when null)
+
+            static Filter Type(Uint32 type) { return {.firstType = type, .lastType = type, .window = {}}; }
+
+            [[nodiscard]] bool Matches(const SDL_Event& event) const;
+        };
+
+        using Notify = void (*)(void* context);
+
+        EventSubscription(EventHub& hub, Filter filter, size_t capacity = DefaultCapacity);
+        ~EventSubscription();
+
+        EventSubscription(const EventSubscription&) = delete;
+        EventSubscription& operator=(const EventSubscription&) = delete;
+
+        [[nodiscard]] const Filter& GetFilter() const { return _filter; }
+        [[nodiscard]] bool IsEmpty() const { return _count == 0; }
+        [[nodiscard]] size_t GetCount() const { return _count; }
+        /// Events dropped because the ring was full
+        [[nodiscard]] uint64_t GetDropped() const { return _dropped; }
+
+        bool TryPop(SDL_Event& event);
+        void Clear();
+
+        /// Callback on every pushed event (null to reset), e.g. to resume a waiting consumer
+        void SetNotify(Notify notify, void* context)
+        {
+            _notify = notify;
+            _notifyContext = context;
+        }
+
+    private:
+        friend class EventHub;
+
+        EventHub& _hub;
+        Filter _filter;
+        std::vector<SDL_Event> _ring; // power of two
+        size_t _head{}; // oldest
+        size_t _count{};
+        uint64_t _dropped{};
+        Notify _notify{};
+        void* _notifyContext{};
+
+        void Push(const SDL_Event& event);
+    };
+
+    /// Fans the runner events out to subscriptions (Sdl3Runner::GetEvents, dispatched from its SDL event callback
+    /// before the handler). Costs one emptiness check per event while nothing is subscribed.
+    class EventHub
+    {
+    public:
+        EventHub() = default;
+        EventHub(const EventHub&) = delete;
+        EventHub& operator=(const EventHub&) = delete;
+
+        void Dispatch(const SDL_Event& event)
+        {
+            if (!_subscriptions.empty()) {
+                DispatchToSubscriptions(event);
+            }
+        }
+
+        [[nodiscard]] size_t GetSubscriptionCount() const { return _subscriptions.size(); }
+
+    private:
+        friend class EventSubscription;
+
+        std::vector<EventSubscription*> _subscriptions;
+
+        void DispatchToSubscriptions(const SDL_Event& event);
+        void Add(EventSubscription& subscription);
+        void Remove(EventSubscription& subscription);
+    };
+}
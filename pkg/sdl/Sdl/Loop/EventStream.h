@@ -0,0 +1,144 @@
+#pragma once
+#include "Sdl/Loop/EventHub.h"
+#include <boost/asio/any_completion_handler.hpp>
+#include <boost/asio/append.hpp>
+#include <boost/asio/associated_cancellation_slot.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/cancellation_type.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace Sdl::Loop
+{
+    /// Awaitable runner events for asio coroutines, e.g. input driven flows (dialogs, tutorials):
+    ///
+    ///     Sdl::Loop::EventStream events{runner->GetEvents()};
+    ///     auto event = co_await events.Next(SDL_EVENT_KEY_DOWN);
+    ///
+    ///     Sdl::Loop::EventStream clicks{runner->GetEvents(), EventSubscription::Filter::Type(SDL_EVENT_MOUSE_BUTTON_DOWN)};
+    ///     while (true) { auto click = co_await clicks.Next(); ... }
+    ///
+    /// Events are queued in the subscription ring between awaits, so none are missed while the coroutine is busy.
+    /// One wait at a time; it supports per-operation cancellation (e.g. awaitable operators w/ a timer) and
+    /// completes w/ operation_aborted when the stream is destroyed. Waiting and completion reuse asio's recycled
+    /// handler memory, so steady-state events don't allocate. Use from the loop thread only.
+    class EventStream
+    {
+    public:
+        using Signature = void(boost::system::error_code, SDL_Event);
+
+        explicit EventStream(EventHub& hub, EventSubscription::Filter filter = {}, size_t capacity = EventSubscription::DefaultCapacity)
+            : _subscription(hub, filter, capacity)
+        {
+            _subscription.SetNotify(&EventStream::OnNotify, this);
+        }
+
+        ~EventStream()
+        {
+            _subscription.SetNotify(nullptr, nullptr);
+            Abort();
+        }
+
+        EventStream(const EventStream&) = delete;
+        EventStream& operator=(const EventStream&) = delete;
+
+        [[nodiscard]] EventSubscription& GetSubscription() { return _subscription; }
+
+        /// Next event of the stream
+        template<typename Token = boost::asio::use_awaitable_t<>>
+            requires(!std::is_convertible_v<Token, Uint32>) // Next(type) otherwise
+        auto Next(Token&& token = {})
+        {
+            return Next(AnyType, std::forward<Token>(token));
+        }
+
+        /// Next event of the type, skipping the queued events of other types
+        template<typename Token = boost::asio::use_awaitable_t<>>
+        auto Next(Uint32 type, Token&& token = {})
+        {
+            return boost::asio::async_initiate<Token, Signature>(
+                [this](auto handler, Uint32 type) { Start(std::move(handler), type); },
+                token,
+                type
+            );
+        }
+
+    private:
+        static constexpr Uint32 AnyType = 0;
+
+        struct CancelHandler
+        {
+            EventStream* stream;
+
+            void operator()(boost::asio::cancellation_type_t /*type*/) const { stream->Abort(); }
+        };
+
+        EventSubscription _subscription;
+        boost::asio::any_completion_handler<Signature> _handler;
+        Uint32 _waitType{};
+
+        template<typename Handler>
+        void Start(Handler handler, Uint32 type)
+        {
+            if (_handler) {
+                Post(std::move(handler), boost::asio::error::in_progress, {});
+                return;
+            }
+            SDL_Event event;
+            if (PopMatching(type, event)) {
+                Post(std::move(handler), {}, event);
+                return;
+            }
+            _handler = std::move(handler);
+            _waitType = type;
+            if (auto slot = boost::asio::get_associated_cancellation_slot(_handler); slot.is_connected()) {
+                slot.template emplace<CancelHandler>(this);
+            }
+        }
+
+        bool PopMatching(Uint32 type, SDL_Event& event)
+        {
+            while (_subscription.TryPop(event)) {
+                if (type == AnyType || event.type == type) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void Complete(const boost::system::error_code& error, const SDL_Event& event)
+        {
+            // also from CancelHandler: clearing destroys it, it doesn't touch itself after Abort
+            if (auto slot = boost::asio::get_associated_cancellation_slot(_handler); slot.is_connected()) {
+                slot.clear();
+            }
+            Post(std::exchange(_handler, nullptr), error, event);
+        }
+
+        void Abort()
+        {
+            if (_handler) {
+                Complete(boost::asio::error::operation_aborted, {});
+            }
+        }
+
+        static void OnNotify(void* context)
+        {
+            auto& self = *static_cast<EventStream*>(context);
+            SDL_Event event;
+            if (self._handler && self.PopMatching(self._waitType, event)) {
+                self.Complete({}, event);
+            }
+        }
+
+        /// Never completes inline: the handler runs on its executor (the coroutine is resumed by the io_context)
+        template<typename Handler>
+        static void Post(Handler&& handler, const boost::system::error_code& error, const SDL_Event& event)
+        {
+            boost::asio::post(boost::asio::append(std::forward<Handler>(handler), error, event));
+        }
+    };
+}
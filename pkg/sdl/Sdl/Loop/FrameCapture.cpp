@@ -0,0 +1,219 @@
+#include "FrameCapture.h"
+#include "Log/Log.h"
+#include "Sdl/Stats/Trace.h"
+#include <SDL3/SDL_error.h>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+namespace Sdl::Loop
+{
+    namespace
+    {
+        constexpr uint8_t QoiOpIndex = 0x00;
+        constexpr uint8_t QoiOpDiff = 0x40;
+        constexpr uint8_t QoiOpLuma = 0x80;
+        constexpr uint8_t QoiOpRun = 0xc0;
+        constexpr uint8_t QoiOpRgb = 0xfe;
+        constexpr uint8_t QoiOpRgba = 0xff;
+        constexpr int QoiMaxRun = 62;
+        constexpr std::array<uint8_t, 8> QoiEnd{0, 0, 0, 0, 0, 0, 0, 1};
+
+        struct Rgba
+        {
+            uint8_t r, g, b, a;
+
+            bool operator==(const Rgba&) const = default;
+        };
+
+        void PushBigEndian(std::vector<uint8_t>& out, uint32_t value)
+        {
+            out.insert(out.end(), {
+                static_cast<uint8_t>(value >> 24),
+                static_cast<uint8_t>(value >> 16),
+                static_cast<uint8_t>(value >> 8),
+                static_cast<uint8_t>(value),
+            });
+        }
+    }
+
+    FrameCapture::FrameCapture(std::string directory, size_t queueLimit)
+        : _directory(std::move(directory))
+        , _queueLimit(std::max<size_t>(queueLimit, 1))
+    {
+        std::error_code error;
+        std::filesystem::create_directories(_directory, error);
+        if (error) {
+            Log::Warn("create_directories '{}' failed: {}", _directory, error.message());
+        }
+        _writer = std::thread([this] { RunWriter(); });
+        Log::Info("capturing to '{}' (queue {})", _directory, _queueLimit);
+    }
+
+    FrameCapture::~FrameCapture()
+    {
+        {
+            std::lock_guard lock{_mutex};
+            _stopping = true;
+        }
+        _wakeup.notify_one();
+        _writer.join();
+        const auto stats = GetStats();
+        Log::Info("captured {} frames: written {} ({} bytes), dropped {}, failed {}",
+            stats.captured, stats.written, stats.bytesWritten, stats.dropped, stats.failed);
+    }
+
+    FrameCapture::Stats FrameCapture::GetStats() const
+    {
+        return {
+            .captured = _captured.load(std::memory_order_relaxed),
+            .dropped = _dropped.load(std::memory_order_relaxed),
+            .written = _written.load(std::memory_order_relaxed),
+            .failed = _failed.load(std::memory_order_relaxed),
+            .bytesWritten = _bytesWritten.load(std::memory_order_relaxed),
+        };
+    }
+
+    bool FrameCapture::Capture(SDL_Renderer* renderer, uint64_t frame)
+    {
+        TX_TRACE_SCOPE("FrameCapture::Capture");
+        {
+            // checked before the readback: a dropped frame costs nothing
+            std::lock_guard lock{_mutex};
+            if (_queue.size() >= _queueLimit) {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        Surface surface{SDL_RenderReadPixels(renderer, nullptr)};
+        if (!surface) {
+            Log::Warn("SDL_RenderReadPixels failed: {}", SDL_GetError());
+            _failed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        _captured.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard lock{_mutex};
+            _queue.push_back({frame, std::move(surface)});
+        }
+        _wakeup.notify_one();
+        return true;
+    }
+
+    void FrameCapture::RunWriter()
+    {
+        Sdl::Stats::Trace::SetThreadName("FrameCapture");
+        std::vector<uint8_t> buffer;
+        std::unique_lock lock{_mutex};
+        while (true) {
+            _wakeup.wait(lock, [this] { return _stopping || !_queue.empty(); });
+            if (_queue.empty()) {
+                return; // stopping with everything written
+            }
+            auto pending = std::move(_queue.front());
+            _queue.pop_front();
+            lock.unlock();
+
+            if (Write(pending, buffer)) {
+                _written.fetch_add(1, std::memory_order_relaxed);
+                _bytesWritten.fetch_add(buffer.size(), std::memory_order_relaxed);
+            } else {
+                _failed.fetch_add(1, std::memory_order_relaxed);
+            }
+            pending.surface.reset();
+            lock.lock();
+        }
+    }
+
+    bool FrameCapture::Write(Pending& pending, std::vector<uint8_t>& buffer) const
+    {
+        TX_TRACE_SCOPE("FrameCapture::Write");
+        auto* surface = pending.surface.get();
+        Surface converted;
+        if (surface->format != SDL_PIXELFORMAT_RGBA32) {
+            converted.reset(SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32));
+            if (!converted) {
+                Log::Warn("frame {}: SDL_ConvertSurface failed: {}", pending.frame, SDL_GetError());
+                return false;
+            }
+            surface = converted.get();
+        }
+        EncodeQoi(*surface, buffer);
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "frame_%06llu.qoi", static_cast<unsigned long long>(pending.frame));
+        const auto path = std::filesystem::path{_directory} / name;
+        std::ofstream out{path, std::ios::binary};
+        out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        if (!out) {
+            Log::Warn("frame {}: write '{}' failed", pending.frame, path.string());
+            return false;
+        }
+        return true;
+    }
+
+    void FrameCapture::EncodeQoi(const SDL_Surface& surface, std::vector<uint8_t>& out, uint8_t channels)
+    {
+        const bool opaque = channels != 4;
+        out.clear();
+        out.reserve(14 + static_cast<size_t>(surface.w) * static_cast<size_t>(surface.h) + QoiEnd.size());
+        out.insert(out.end(), {'q', 'o', 'i', 'f'});
+        PushBigEndian(out, static_cast<uint32_t>(surface.w));
+        PushBigEndian(out, static_cast<uint32_t>(surface.h));
+        out.push_back(opaque ? 3 : 4);
+        out.push_back(0); // colorspace: sRGB with linear alpha
+
+        // same start state as the decoder: a zeroed (transparent black) index, opaque black previous pixel
+        std::array<Rgba, 64> index{};
+        Rgba previous{0, 0, 0, 255};
+        int run = 0;
+        for (int y = 0; y < surface.h; ++y) {
+            const auto* row = static_cast<const uint8_t*>(surface.pixels) + static_cast<ptrdiff_t>(y) * surface.pitch;
+            for (int x = 0; x < surface.w; ++x) {
+                const auto* bytes = row + static_cast<ptrdiff_t>(x) * 4; // RGBA32 byte order
+                const Rgba pixel{bytes[0], bytes[1], bytes[2], opaque ? uint8_t{255} : bytes[3]};
+                if (pixel == previous) {
+                    if (++run == QoiMaxRun) {
+                        out.push_back(static_cast<uint8_t>(QoiOpRun | (run - 1)));
+                        run = 0;
+                    }
+                    continue;
+                }
+                if (run > 0) {
+                    out.push_back(static_cast<uint8_t>(QoiOpRun | (run - 1)));
+                    run = 0;
+                }
+
+                const auto hash = (pixel.r * 3 + pixel.g * 5 + pixel.b * 7 + pixel.a * 11) % 64;
+                if (index[hash] == pixel) {
+                    out.push_back(static_cast<uint8_t>(QoiOpIndex | hash));
+                } else {
+                    index[hash] = pixel;
+                    const auto dr = static_cast<int8_t>(pixel.r - previous.r);
+                    const auto dg = static_cast<int8_t>(pixel.g - previous.g);
+                    const auto db = static_cast<int8_t>(pixel.b - previous.b);
+                    const auto dgr = dr - dg;
+                    const auto dgb = db - dg;
+                    if (pixel.a != previous.a) {
+                        out.insert(out.end(), {QoiOpRgba, pixel.r, pixel.g, pixel.b, pixel.a});
+                    } else if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                        out.push_back(static_cast<uint8_t>(QoiOpDiff | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)));
+                    } else if (dgr >= -8 && dgr <= 7 && dg >= -32 && dg <= 31 && dgb >= -8 && dgb <= 7) {
+                        out.push_back(static_cast<uint8_t>(QoiOpLuma | (dg + 32)));
+                        out.push_back(static_cast<uint8_t>(((dgr + 8) << 4) | (dgb + 8)));
+                    } else {
+                        out.insert(out.end(), {QoiOpRgb, pixel.r, pixel.g, pixel.b});
+                    }
+                }
+                previous = pixel;
+            }
+        }
+        if (run > 0) {
+            out.push_back(static_cast<uint8_t>(QoiOpRun | (run - 1)));
+        }
+        out.insert(out.end(), QoiEnd.begin(), QoiEnd.end());
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Sdl/Sdl3Ptr.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Sdl::Loop
+{
+    /// Frame capture to a QOI image sequence (<directory>/frame_NNNNNN.qoi).
+    /// Only the readback (SDL_RenderReadPixels) runs on the render thread; pixel conversion, encoding and
+    /// file writes happen on a writer thread. When the writer falls behind by more than the queue limit,
+    /// frames are dropped instead of stalling the loop (see Stats::dropped).
+    class FrameCapture
+    {
+    public:
+        struct Stats
+        {
+            uint64_t captured = 0;
+            uint64_t dropped = 0;
+            uint64_t written = 0;
+            uint64_t failed = 0;
+            uint64_t bytesWritten = 0;
+        };
+
+        FrameCapture(std::string directory, size_t queueLimit);
+        /// Writes the queued frames and stops the writer
+        ~FrameCapture();
+
+        FrameCapture(const FrameCapture&) = delete;
+        FrameCapture& operator=(const FrameCapture&) = delete;
+
+        /// Read back the current render target (call before present), false if dropped or failed
+        bool Capture(SDL_Renderer* renderer, uint64_t frame);
+
+        [[nodiscard]] Stats GetStats() const;
+        [[nodiscard]] const std::string& GetDirectory() const { return _directory; }
+
+        /// QOI (https://qoiformat.org) encoding of an RGBA32 surface.
+        /// With 3 channels (frames) alpha is ignored and the image is opaque, with 4 it's kept.
+        static void EncodeQoi(const SDL_Surface& surface, std::vector<uint8_t>& out, uint8_t channels = 3);
+
+    private:
+        struct Pending
+        {
+            uint64_t frame;
+            Surface surface;
+        };
+
+        std::string _directory;
+        size_t _queueLimit;
+
+        std::mutex _mutex;
+        std::condition_variable _wakeup;
+        std::deque<Pending> _queue;
+        bool _stopping = false;
+
+        std::atomic<uint64_t> _captured{0};
+        std::atomic<uint64_t> _dropped{0};
+        std::atomic<uint64_t> _written{0};
+        std::atomic<uint64_t> _failed{0};
+        std::atomic<uint64_t> _bytesWritten{0};
+
+        std::thread _writer; // last: started after the state above is constructed
+
+        void RunWriter();
+        bool Write(Pending& pending, std::vector<uint8_t>& buffer) const;
+    };
+}
@@ -0,0 +1,106 @@
+#include "InputReplay.h"
+#include "Log/Log.h"
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace Sdl::Loop
+{
+    namespace
+    {
+        bool ParseEvent(std::istringstream& line, const std::string& type, SDL_Event& event)
+        {
+            if (type == "key_down" || type == "key_up") {
+                SDL_Keycode key{};
+                if (!(line >> key)) {
+                    return false;
+                }
+                event.type = type == "key_down" ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+                event.key.key = key;
+                event.key.down = event.type == SDL_EVENT_KEY_DOWN;
+                return true;
+            }
+            if (type == "mouse_move") {
+                event.type = SDL_EVENT_MOUSE_MOTION;
+                return static_cast<bool>(line >> event.motion.x >> event.motion.y);
+            }
+            if (type == "mouse_down" || type == "mouse_up") {
+                int button{};
+                if (!(line >> button >> event.button.x >> event.button.y)) {
+                    return false;
+                }
+                event.type = type == "mouse_down" ? SDL_EVENT_MOUSE_BUTTON_DOWN : SDL_EVENT_MOUSE_BUTTON_UP;
+                event.button.button = static_cast<Uint8>(button);
+                event.button.down = event.type == SDL_EVENT_MOUSE_BUTTON_DOWN;
+                event.button.clicks = 1;
+                return true;
+            }
+            if (type == "quit") {
+                event.type = SDL_EVENT_QUIT;
+                return true;
+            }
+            return false;
+        }
+    }
+
+    bool InputReplay::Load(const std::string& path)
+    {
+        std::ifstream in{path};
+        if (!in) {
+            Log::Error("cannot open input replay: {}", path);
+            return false;
+        }
+
+        _events.clear();
+        _next = 0;
+        std::string text;
+        for (size_t lineNumber = 1; std::getline(in, text); ++lineNumber) {
+            if (auto comment = text.find('#'); comment != std::string::npos) {
+                text.resize(comment);
+            }
+            std::istringstream line{text};
+            uint64_t frame{};
+            std::string type;
+            if (!(line >> frame >> type)) {
+                continue; // empty line
+            }
+            SDL_Event event{};
+            if (!ParseEvent(line, type, event)) {
+                Log::Error("input replay {}:{}: invalid event '{}'", path, lineNumber, text);
+                return false;
+            }
+            _events.push_back({.frame = frame, .event = event});
+        }
+        std::ranges::stable_sort(_events, {}, &Entry::frame);
+        Log::Debug("input replay: {} events from {}", _events.size(), path);
+        return true;
+    }
+
+    void InputReplay::PushFrame(uint64_t frame, SDL_WindowID windowId)
+    {
+        for (; _next < _events.size() && _events[_next].frame <= frame; ++_next) {
+            auto event = _events[_next].event;
+            event.common.timestamp = SDL_GetTicksNS();
+            switch (event.type) {
+            case SDL_EVENT_KEY_DOWN:
+            case SDL_EVENT_KEY_UP:
+                event.key.windowID = windowId;
+                break;
+            case SDL_EVENT_MOUSE_MOTION:
+                event.motion.windowID = windowId;
+                break;
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+                event.button.windowID = windowId;
+                break;
+            default:
+                break;
+            }
+            if (!SDL_PushEvent(&event)) {
+                Log::Warn("SDL_PushEvent failed: {}", SDL_GetError());
+            }
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <SDL3/SDL_events.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Sdl::Loop
+{
+    /// Scripted input for reproducible harness runs.
+    /// Text format, one event per line (`#` starts a comment):
+    ///   <frame> key_down|key_up <keycode>
+    ///   <frame> mouse_move <x> <y>
+    ///   <frame> mouse_down|mouse_up <button> <x> <y>
+    ///   <frame> quit
+    class InputReplay
+    {
+    public:
+        bool Load(const std::string& path);
+
+        /// Push events of the given frame to the SDL queue (delivered before that frame's update)
+        void PushFrame(uint64_t frame, SDL_WindowID windowId);
+
+        [[nodiscard]] bool Empty() const { return _next >= _events.size(); }
+
+    private:
+        struct Entry
+        {
+            uint64_t frame;
+            SDL_Event event;
+        };
+
+        std::vector<Entry> _events; // sorted by frame
+        size_t _next = 0;
+    };
+}
@@ -1,6 +1,12 @@
 #include "Sdl3Runner.h"
 #include "Log/Log.h"
+#include "Sdl/Stats/StartupTrace.h"
+#include "Sdl/Stats/Trace.h"
 #include <boost/describe.hpp>
+#include <algorithm>
+#include <sstream>
+#include <utility>
+#include <string_view>
 
 #define SDL_MAIN_HANDLED
 #include <SDL3/SDL_main.h>
@@ -14,6 +20,28 @@ namespace
 {
     // Thread-local for passing 'this' to SDL callbacks
     thread_local Sdl::Loop::Sdl3Runner* g_currentSdl3Runner = nullptr;
+
+    std::string_view GetEnv(const char* name)
+    {
+        const auto* value = SDL_getenv(name);
+        return value ? std::string_view{value} : std::string_view{};
+    }
+
+    template<typename T>
+    T ParseEnv(const char* name, T defaultValue)
+    {
+        auto text = GetEnv(name);
+        if (text.empty()) {
+            return defaultValue;
+        }
+        std::istringstream stream{std::string{text}};
+        T value{};
+        if (!(stream >> value) || !(stream >> std::ws).eof()) {
+            Log::Warn("invalid {}='{}', using {}", name, text, defaultValue);
+            return defaultValue;
+        }
+        return value;
+    }
 }
 
 namespace Sdl::Loop
@@ -30,6 +58,16 @@ namespace Sdl::Loop
         , _options{std::move(options)}
         , _updateCtx{*this}
     {
+        if (!_options.Harness) {
+            _options.Harness = HarnessConfig::FromEnvironment();
+        }
+        if (!_options.Capture) {
+            _options.Capture = CaptureConfig::FromEnvironment();
+        }
+        _tracePath = GetEnv("TX_TRACE");
+        if (!_tracePath.empty()) {
+            Stats::Trace::Start(); // from the start, so DoInit is in the trace
+        }
         Log::Trace("created");
     }
 
@@ -101,6 +139,8 @@ namespace Sdl::Loop
 
     SDL_AppResult Sdl3Runner::DoInit()
     {
+        Stats::Trace::SetThreadName("main");
+        TX_TRACE_SCOPE("Sdl3Runner::DoInit");
         Log::Trace("options: '{}' {}x{} vsync={}", 
             _options.Window.Title,
             _options.Window.Width,
@@ -110,11 +150,17 @@ namespace Sdl::Loop
 
         // Main
         //TODO: SDL_SetAppMetadata("appname", "1.0", "com.group.identifier");
+        const auto headless = _options.Harness && _options.Harness->Headless;
+        if (headless) {
+            SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+        }
         if (!SDL_Init(_options.InitFlags))
         {
             Log::Error("SDL_Init failed: {}", SDL_GetError());
             return SDL_APP_FAILURE;
         }
+        Stats::StartupTrace::Mark(Stats::StartupMark::SdlInit);
+        RegisterWakeEvent();
         auto primaryDisplay = SDL_GetPrimaryDisplay();
         auto naturalOrientation = SDL_GetNaturalDisplayOrientation(primaryDisplay);
         auto currentOrientation = SDL_GetCurrentDisplayOrientation(primaryDisplay);
@@ -147,6 +193,7 @@ namespace Sdl::Loop
             return SDL_APP_FAILURE;
         }
         _window = Window{window};
+        Stats::StartupTrace::Mark(Stats::StartupMark::Window);
 #if __ANDROID__
         // issue workaround to hide navigation bar on Android because
         // - navigation bar isn't hidden until switching app
@@ -176,25 +223,40 @@ namespace Sdl::Loop
         );
 
         // Renderer
-        _renderer = Renderer{SDL_CreateRenderer(window, nullptr)};
+        _renderer = Renderer{SDL_CreateRenderer(window, headless ? SDL_SOFTWARE_RENDERER : nullptr)};
         if (!_renderer) {
             Log::Error("SDL_CreateRenderer failed: {}", SDL_GetError());
             _window.reset();
             return SDL_APP_FAILURE;
         }
+        Stats::StartupTrace::Mark(Stats::StartupMark::Renderer);
+        _renderState.emplace(_renderer.get());
+        _texturePool.emplace(_renderer.get());
 
-        if (!SDL_SetRenderVSync(_renderer.get(), _options.VSync)) {
-            Log::Warn("SDL_SetRenderVSync({}) not supported, using disabled", _options.VSync);
+        const auto vsync = _options.Harness ? SDL_RENDERER_VSYNC_DISABLED : _options.VSync; // harness measures uncapped frames
+        if (!SDL_SetRenderVSync(_renderer.get(), vsync)) {
+            Log::Warn("SDL_SetRenderVSync({}) not supported, using disabled", vsync);
             SDL_SetRenderVSync(_renderer.get(), SDL_RENDERER_VSYNC_DISABLED);
         }
 
         // User handler
         if (!InvokeStart()) {
             Log::Error("Started handler failed");
+            _texturePool.reset();
+            _renderState.reset();
             _renderer.reset();
             _window.reset();
             return SDL_APP_FAILURE;
         }
+        Stats::StartupTrace::Mark(Stats::StartupMark::HandlerStart);
+
+        if (_options.Harness && !HarnessInit()) {
+            return SDL_APP_FAILURE;
+        }
+        if (_options.Capture) {
+            _options.Capture->Interval = std::max<uint64_t>(_options.Capture->Interval, 1); // also when set in Options
+            _capture = std::make_unique<FrameCapture>(_options.Capture->Directory, _options.Capture->QueueLimit);
+        }
 
         Log::Trace("completed");
         return SDL_APP_CONTINUE;
@@ -221,11 +283,22 @@ namespace Sdl::Loop
 
         _running = false;
         InvokeStop();
+        if (_profiler) {
+            HarnessQuit();
+        }
+        _capture.reset(); // flushes the queued frames
 
+        _texturePool.reset();
+        _renderState.reset();
         _renderer.reset();
         _window.reset();
 
         SDL_Quit();
+        Stats::StartupTrace::Finish(_options.Window.Title);
+        if (!_tracePath.empty()) {
+            Stats::Trace::Stop();
+            Stats::Trace::WriteJson(_tracePath);
+        }
 
 #if __EMSCRIPTEN__
         // pospone runtime exit 
@@ -255,23 +328,116 @@ namespace Sdl::Loop
         if (!_running) {
             return SDL_APP_SUCCESS;
         }
+        TX_TRACE_SCOPE("Sdl3Runner::DoIterate");
 
         // Update timing
         _updateCtx.Tick();
+        if (_profiler) {
+            HarnessBeginFrame();
+        }
+        TX_TRACE_COUNTER("frame_ms", _updateCtx.frame.deltaSeconds * 1000.0f);
 
         // Call update action
-        InvokeUpdate(_updateCtx);
+        {
+            Stats::FrameProfiler::Scope scope{Stats::FramePhase::Update};
+            PumpWork();
+            TX_TRACE_SCOPE("Update");
+            InvokeUpdate(_updateCtx);
+        }
 
         //TODO: if handler Update did not render anything - Default: clear with dark blue
         // SDL_SetRenderDrawColor(_renderer, 30, 30, 80, 255);
         // SDL_RenderClear(_renderer);
 
-        SDL_RenderPresent(_renderer.get());
+        {
+            Stats::FrameProfiler::Scope scope{Stats::FramePhase::Present};
+            TX_TRACE_SCOPE("Present");
+            if (_capture) {
+                CaptureFrame(); // back buffer is undefined after present
+            }
+            SDL_RenderPresent(_renderer.get());
+        }
+        _texturePool->EndFrame();
+        Stats::StartupTrace::Mark(Stats::StartupMark::FirstPresent);
+
+        // since the end of the previous frame, so allocations of the events in between are counted too
+        const auto& allocations = Stats::AllocTracker::GetThreadCounters();
+        _frameAllocations = allocations.Since(_frameAllocationsStart);
+        _frameAllocationsStart = allocations;
+        TX_TRACE_COUNTER("frame_allocations", _frameAllocations.allocations);
+        if (_profiler) {
+            _profiler->SetFrameAllocations(_frameAllocations);
+            HarnessEndFrame();
+        }
+        WaitIdle();
         return SDL_APP_CONTINUE;
     }
 
+    void Sdl3Runner::PumpWork()
+    {
+        if (!_options.Pump) {
+            return;
+        }
+        TX_TRACE_SCOPE("Pump");
+        const auto budget = std::chrono::duration_cast<WorkPump::Clock::duration>(std::chrono::duration<float>(_options.PumpBudgetSeconds));
+        _pumpBacklog = _options.Pump->Poll(WorkPump::Clock::now() + budget);
+    }
+
+    void Sdl3Runner::WaitIdle()
+    {
+#if !__EMSCRIPTEN__ // can't block the browser loop
+        if (!_options.WaitEvents || _options.Harness || !_running) {
+            return;
+        }
+        if (std::exchange(_frameRequested, false) || _pumpBacklog) {
+            return;
+        }
+        TX_TRACE_SCOPE("Idle");
+        // SDL events (including Wake) end the wait, pending pump work is polled at the idle bound
+        const auto pending = _options.Pump && _options.Pump->HasPendingWork();
+        const auto timeoutMs = pending ? std::max(1, static_cast<int>(_options.PumpIdleSeconds * 1000.0f)) : -1;
+        SDL_WaitEventTimeout(nullptr, timeoutMs);
+#endif
+    }
+
+    void Sdl3Runner::RegisterWakeEvent()
+    {
+        if (!_wakeEventType.load(std::memory_order_relaxed)) {
+            _wakeEventType.store(SDL_RegisterEvents(1), std::memory_order_relaxed);
+        }
+    }
+
+    bool Sdl3Runner::ConsumeWakeEvent(const SDL_Event& event)
+    {
+        const auto type = _wakeEventType.load(std::memory_order_relaxed);
+        if (!type || event.type != type) {
+            return false;
+        }
+        _wakePending.store(false, std::memory_order_release);
+        return true;
+    }
+
+    void Sdl3Runner::Wake()
+    {
+        const auto type = _wakeEventType.load(std::memory_order_relaxed);
+        if (!type || _wakePending.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        SDL_Event event{};
+        event.type = type;
+        if (!SDL_PushEvent(&event)) {
+            _wakePending.store(false, std::memory_order_release);
+        }
+    }
+
     SDL_AppResult Sdl3Runner::DoEvent(SDL_Event* event)
     {
+        if (ConsumeWakeEvent(*event)) {
+            return SDL_APP_CONTINUE; // only ends the idle wait
+        }
+        TX_TRACE_SCOPE("Sdl3Runner::DoEvent");
+        _events.Dispatch(*event);
+
         // Forward to user callback
         auto rc = _sdlHandler->Sdl3Event(*this, *event);
         if (rc != SDL_APP_CONTINUE) {
@@ -280,4 +446,100 @@ namespace Sdl::Loop
 
         return SDL_APP_CONTINUE;
     }
+
+    std::optional<Sdl3Runner::HarnessConfig> Sdl3Runner::HarnessConfig::FromEnvironment()
+    {
+        if (GetEnv("TX_HARNESS_FRAMES").empty()) {
+            return std::nullopt;
+        }
+        return HarnessConfig{
+            .Frames = ParseEnv<uint64_t>("TX_HARNESS_FRAMES", 0),
+            .FixedDeltaSeconds = ParseEnv<float>("TX_HARNESS_FIXED_DT", 0.0f),
+            .Headless = ParseEnv<int>("TX_HARNESS_HEADLESS", 0) != 0,
+            .InputPath = std::string{GetEnv("TX_HARNESS_INPUT")},
+            .ReportPath = std::string{GetEnv("TX_HARNESS_REPORT")},
+            .Name = std::string{GetEnv("TX_HARNESS_NAME")},
+            .WarmupFrames = ParseEnv<uint64_t>("TX_HARNESS_WARMUP", HarnessConfig{}.WarmupFrames),
+            .RecordLimit = ParseEnv<uint64_t>("TX_HARNESS_RECORD_LIMIT", HarnessConfig{}.RecordLimit),
+        };
+    }
+
+    bool Sdl3Runner::HarnessInit()
+    {
+        const auto& harness = *_options.Harness;
+        Log::Info("harness: frames={} fixed-dt={} headless={} input='{}' report='{}' warmup={} alloc-hooks={}",
+            harness.Frames,
+            harness.FixedDeltaSeconds,
+            harness.Headless,
+            harness.InputPath,
+            harness.ReportPath,
+            harness.WarmupFrames,
+            Stats::AllocTracker::IsHooked()
+        );
+        if (!harness.InputPath.empty() && !_inputReplay.Load(harness.InputPath)) {
+            return false;
+        }
+        // records are reserved up front: growing them would allocate inside the measured frames
+        _profiler = std::make_unique<Stats::FrameProfiler>(harness.Frames > 0 ? harness.Frames : harness.RecordLimit);
+        Stats::FrameProfiler::SetCurrent(_profiler.get());
+        _inputReplay.PushFrame(_harnessFrame, SDL_GetWindowID(_window.get()));
+        return true;
+    }
+
+    void Sdl3Runner::HarnessBeginFrame()
+    {
+        if (auto fixedDelta = _options.Harness->FixedDeltaSeconds; fixedDelta > 0.0f) {
+            // deterministic simulation time regardless of how long frames take
+            _updateCtx.frame.deltaSeconds = fixedDelta;
+            _updateCtx.session.passedSeconds = static_cast<decltype(_updateCtx.session.passedSeconds)>(
+                static_cast<double>(fixedDelta) * static_cast<double>(_harnessFrame + 1));
+        }
+        _profiler->BeginFrame(_harnessFrame);
+    }
+
+    void Sdl3Runner::HarnessEndFrame()
+    {
+        _profiler->EndFrame();
+        ++_harnessFrame;
+        if (auto frames = _options.Harness->Frames; frames > 0 && _harnessFrame >= frames) {
+            Log::Info("harness: {} frames completed", _harnessFrame);
+            Exit(RunLoop::ExitCode::Success);
+            return;
+        }
+        _inputReplay.PushFrame(_harnessFrame, SDL_GetWindowID(_window.get()));
+    }
+
+    void Sdl3Runner::HarnessQuit()
+    {
+        Stats::FrameProfiler::SetCurrent(nullptr);
+        const auto& harness = *_options.Harness;
+        if (!harness.ReportPath.empty()) {
+            _profiler->WriteReport(harness.ReportPath, harness.Name.empty() ? _options.Window.Title : harness.Name, harness.WarmupFrames);
+        }
+        _profiler.reset();
+    }
+
+    std::optional<Sdl3Runner::CaptureConfig> Sdl3Runner::CaptureConfig::FromEnvironment()
+    {
+        auto directory = GetEnv("TX_CAPTURE_DIR");
+        if (directory.empty()) {
+            return std::nullopt;
+        }
+        return CaptureConfig{
+            .Directory = std::string{directory},
+            .Interval = std::max<uint64_t>(ParseEnv<uint64_t>("TX_CAPTURE_INTERVAL", 1), 1),
+            .Frames = ParseEnv<uint64_t>("TX_CAPTURE_FRAMES", 0),
+            .QueueLimit = ParseEnv<size_t>("TX_CAPTURE_QUEUE", 8),
+        };
+    }
+
+    void Sdl3Runner::CaptureFrame()
+    {
+        const auto& capture = *_options.Capture;
+        const auto frame = _captureFrame++;
+        if (frame % capture.Interval != 0 || (capture.Frames > 0 && frame / capture.Interval >= capture.Frames)) {
+            return;
+        }
+        _capture->Capture(_renderer.get(), frame);
+    }
 }
@@ -1,8 +1,17 @@
 #pragma once
 #include "RunLoop/Handler.h"
 #include "RunLoop/Runner.h"
+#include "Sdl/Loop/EventHub.h"
+#include "Sdl/Loop/FrameCapture.h"
+#include "Sdl/Loop/InputReplay.h"
+#include "Sdl/Loop/WorkPump.h"
+#include "Sdl/RenderState.h"
 #include "Sdl/Sdl3Ptr.h"
+#include "Sdl/Stats/AllocTracker.h"
+#include "Sdl/Stats/FrameProfiler.h"
+#include "Sdl/TexturePool.h"
 #include <atomic>
+#include <optional>
 
 namespace Sdl::Loop
 {
@@ -36,6 +45,38 @@ namespace Sdl::Loop
                 ;
         };
 
+        /// Harness mode for reproducible performance runs: fixed frame count and clock, optional headless
+        /// video and replayed input, per-frame phase timings report written on exit
+        struct HarnessConfig
+        {
+            uint64_t Frames = 0; // exit after this many frames (0 - run until exit)
+            float FixedDeltaSeconds = 0.0f; // injected fixed clock step (0 - real clock)
+            bool Headless = false; // offscreen video driver and software renderer
+            std::string InputPath; // replayed input script (see InputReplay)
+            std::string ReportPath; // phase timings report (.json summary or .csv frames)
+            std::string Name; // report name (window title by default)
+            uint64_t WarmupFrames = 60; // frames excluded from the steady state allocations of the report
+            uint64_t RecordLimit = 36'000; // frames recorded when Frames is 0 (later ones are dropped from the report)
+
+            /// Read from TX_HARNESS_FRAMES, TX_HARNESS_FIXED_DT, TX_HARNESS_HEADLESS, TX_HARNESS_INPUT, TX_HARNESS_REPORT,
+            /// TX_HARNESS_NAME, TX_HARNESS_WARMUP, TX_HARNESS_RECORD_LIMIT environment variables
+            /// (nullopt when TX_HARNESS_FRAMES isn't set)
+            static std::optional<HarnessConfig> FromEnvironment();
+        };
+
+        /// Frame capture to a QOI image sequence (visual regression, headless repro recordings)
+        struct CaptureConfig
+        {
+            std::string Directory; // frame_NNNNNN.qoi files
+            uint64_t Interval = 1; // capture every Nth frame (0 is taken as 1)
+            uint64_t Frames = 0; // stop capturing after this many frames (0 - no limit)
+            size_t QueueLimit = 8; // frames waiting for the writer before dropping
+
+            /// Read from TX_CAPTURE_DIR, TX_CAPTURE_INTERVAL, TX_CAPTURE_FRAMES, TX_CAPTURE_QUEUE environment variables
+            /// (nullopt when TX_CAPTURE_DIR isn't set)
+            static std::optional<CaptureConfig> FromEnvironment();
+        };
+
         struct Options
         {
             SDL_InitFlags InitFlags = 
@@ -47,6 +88,22 @@ namespace Sdl::Loop
             /// VSync setting (1 = enabled, 0 = disabled, -1 = adaptive)
             /// Enabled by default
             int VSync = 1;
+
+            /// Harness mode (taken from environment when not set, disables VSync)
+            std::optional<HarnessConfig> Harness{};
+
+            /// Frame capture (taken from environment when not set)
+            std::optional<CaptureConfig> Capture{};
+
+            /// Work run before every frame update (e.g. AsioPump) for at most PumpBudgetSeconds
+            std::shared_ptr<WorkPump> Pump{};
+            float PumpBudgetSeconds = 0.002f;
+
+            /// Render on demand: between frames block until an SDL event, Wake() or RequestFrame() instead of
+            /// rendering continuously (ignored in harness mode and on emscripten)
+            bool WaitEvents = false;
+            /// Bound of the idle wait while the pump has pending work (its timers and sockets are checked this often)
+            float PumpIdleSeconds = 0.01f;
         };
 
         using Sdl3HandlerPtr = std::shared_ptr<Sdl3Handler>;
@@ -61,7 +118,24 @@ namespace Sdl::Loop
         // Sdl3-specific accessors
         [[nodiscard]] SDL_Window* GetWindow() const { return _window.get(); }
         [[nodiscard]] SDL_Renderer* GetRenderer() const { return _renderer.get(); }
+        /// Shadowed state of the renderer (valid while the renderer exists)
+        [[nodiscard]] RenderState& GetRenderState() { return *_renderState; }
+        /// Recycled temporary textures of the renderer (leases must be released before the handler stops)
+        [[nodiscard]] TexturePool& GetTexturePool() { return *_texturePool; }
         [[nodiscard]] bool IsRunning() const { return _running; }
+        /// Subscriptions to the events of the loop (see EventStream of //pkg/sdl:asio), must not outlive the runner
+        [[nodiscard]] EventHub& GetEvents() { return _events; }
+
+        /// Render the next frame w/o waiting for events (WaitEvents mode, e.g. while animating)
+        void RequestFrame() { _frameRequested = true; }
+        /// End the idle wait of the WaitEvents mode (thread-safe, repeated calls coalesce into one wake event)
+        static void Wake();
+        /// Register the wake event type (done on init, Wake is a no-op before), SDL events must be initialized
+        static void RegisterWakeEvent();
+        /// Whether the event is the wake one: consuming it lets the next Wake push a new event
+        static bool ConsumeWakeEvent(const SDL_Event& event);
+        /// Heap allocations of the loop thread during the last frame, events included (zero w/o //pkg/sdl:alloc_hooks)
+        [[nodiscard]] const Stats::AllocTracker::Counters& GetFrameAllocations() const { return _frameAllocations; }
 
     private:
         Sdl3HandlerPtr _sdlHandler;
@@ -72,9 +146,33 @@ namespace Sdl::Loop
 
         Window _window;
         Renderer _renderer;
+        std::optional<RenderState> _renderState;
+        std::optional<TexturePool> _texturePool;
 
         RunLoop::UpdateCtx _updateCtx;
         std::atomic<bool> _running{false};
+        EventHub _events;
+
+        // Work pump and idle wait
+        bool _pumpBacklog{}; // budget ran out w/ ready work left
+        bool _frameRequested{};
+        static inline std::atomic<Uint32> _wakeEventType{0};
+        static inline std::atomic<bool> _wakePending{false};
+
+        Stats::AllocTracker::Counters _frameAllocations{};
+        Stats::AllocTracker::Counters _frameAllocationsStart{};
+
+        // Harness mode
+        uint64_t _harnessFrame{};
+        std::unique_ptr<Stats::FrameProfiler> _profiler;
+        InputReplay _inputReplay;
+
+        // Capture mode
+        std::unique_ptr<FrameCapture> _capture;
+        uint64_t _captureFrame{};
+
+        // Trace session written on quit (TX_TRACE=<file.json>)
+        std::string _tracePath;
 
         static SDL_AppResult SDLCALL AppInit(void** appstate, int argc, char** argv);
 
@@ -83,5 +181,15 @@ namespace Sdl::Loop
         void DoQuit(SDL_AppResult result);
         SDL_AppResult DoIterate();
         SDL_AppResult DoEvent(SDL_Event* event);
+
+        bool HarnessInit();
+        void HarnessBeginFrame();
+        void HarnessEndFrame();
+        void HarnessQuit();
+
+        void CaptureFrame();
+
+        void PumpWork();
+        void WaitIdle();
     };
 }
@@ -0,0 +1,23 @@
+#pragma once
+#include <chrono>
+
+namespace Sdl::Loop
+{
+    /// Work run by Sdl3Runner on the loop thread before every frame update within a time budget
+    /// (see AsioPump of //pkg/sdl:asio for an asio io_context), so a burst of ready work is spread over frames
+    /// instead of blowing one. Work arriving from other threads should call Sdl3Runner::Wake() to end an idle wait.
+    class WorkPump
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        virtual ~WorkPump() = default;
+
+        /// Run ready work until it's drained or the deadline passes, returns whether ready work is left
+        virtual bool Poll(Clock::time_point deadline) = 0;
+
+        /// Whether work may become ready w/o waking the loop (e.g. pending timers or sockets),
+        /// the idle wait is bounded then
+        [[nodiscard]] virtual bool HasPendingWork() const = 0;
+    };
+}
@@ -0,0 +1,167 @@
+#include "DebugText.h"
+#include "Log/Log.h"
+#include "Sdl/RendererScopes.h"
+#include <SDL3/SDL_error.h>
+#include <cstdarg>
+#include <cstdio>
+
+namespace Sdl::Render
+{
+    namespace
+    {
+        constexpr int FontColumns = 16;
+        constexpr int FontRows = 8; // ASCII 0..127
+        constexpr int FontGlyphSize = SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE;
+        constexpr float FontTexelU = 1.0f / FontColumns;
+        constexpr float FontTexelV = 1.0f / FontRows;
+        constexpr unsigned char MissingGlyph = '?';
+    }
+
+    DebugText::DebugText(RenderState& state)
+        : _state(state)
+    {}
+
+    bool DebugText::CreateFont()
+    {
+        auto* renderer = _state.GetRenderer();
+        _font.reset(SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, FontColumns * FontGlyphSize, FontRows * FontGlyphSize));
+        if (!_font) {
+            Log::Warn("glyph texture failed, drawing per line: {}", SDL_GetError());
+            return false;
+        }
+        SDL_SetTextureScaleMode(_font.get(), SDL_SCALEMODE_NEAREST);
+        SDL_SetTextureBlendMode(_font.get(), SDL_BLENDMODE_BLEND);
+
+        SetTargetScope targetScope{_state, _font.get()};
+        SetRenderScaleScope scaleScope{_state, 1.0f, 1.0f};
+        SetBlendModeScope blendScope{_state, SDL_BLENDMODE_NONE};
+        SetDrawColorScope colorScope{_state, SDL_Color{255, 255, 255, SDL_ALPHA_TRANSPARENT}};
+        SDL_RenderClear(renderer); // transparent white: no dark fringes when filtered
+        _state.SetBlendMode(SDL_BLENDMODE_BLEND);
+        _state.SetDrawColor(255, 255, 255);
+        for (int code = ' '; code < FontColumns * FontRows; ++code) {
+            const char glyph[2] = {static_cast<char>(code), '\0'};
+            SDL_RenderDebugText(renderer,
+                static_cast<float>((code % FontColumns) * FontGlyphSize),
+                static_cast<float>((code / FontColumns) * FontGlyphSize),
+                glyph);
+        }
+        return true;
+    }
+
+    void DebugText::Print(float x, float y, std::string_view text)
+    {
+        ++_stats.lines;
+        if (_lineCount == _lines.size()) {
+            _lines.emplace_back();
+        }
+        auto& line = _lines[_lineCount++];
+        const auto& color = line.color;
+        if (line.text == text && line.position.x == x && line.position.y == y && line.scale == _scale
+            && color.r == _color.r && color.g == _color.g && color.b == _color.b && color.a == _color.a) {
+            ++_stats.cachedLines;
+            return;
+        }
+        line.text.assign(text);
+        line.position = {x, y};
+        line.scale = _scale;
+        line.color = _color;
+        BuildQuads(line);
+    }
+
+    void DebugText::Printf(float x, float y, const char* format, ...)
+    {
+        std::va_list args;
+        va_start(args, format);
+        std::va_list retry;
+        va_copy(retry, args);
+        _format.resize(_format.capacity());
+        auto length = std::vsnprintf(_format.data(), _format.size() + 1, format, args);
+        va_end(args);
+        if (length > static_cast<int>(_format.size())) {
+            _format.resize(static_cast<size_t>(length));
+            length = std::vsnprintf(_format.data(), _format.size() + 1, format, retry);
+        }
+        va_end(retry);
+        Print(x, y, std::string_view{_format.data(), static_cast<size_t>(std::max(length, 0))});
+    }
+
+    void DebugText::BuildQuads(Line& line) const
+    {
+        const SDL_FColor color{line.color.r / 255.0f, line.color.g / 255.0f, line.color.b / 255.0f, line.color.a / 255.0f};
+        const auto size = GlyphSize * line.scale;
+        const auto top = line.position.y * line.scale;
+        auto left = line.position.x * line.scale;
+
+        line.vertices.clear();
+        for (const auto symbol : line.text) {
+            auto code = static_cast<unsigned char>(symbol);
+            if (code == ' ') {
+                left += size;
+                continue;
+            }
+            if (code < ' ' || code >= FontColumns * FontRows) {
+                code = MissingGlyph;
+            }
+            const auto u = static_cast<float>(code % FontColumns) * FontTexelU;
+            const auto v = static_cast<float>(code / FontColumns) * FontTexelV;
+            line.vertices.push_back({{left, top}, color, {u, v}});
+            line.vertices.push_back({{left + size, top}, color, {u + FontTexelU, v}});
+            line.vertices.push_back({{left + size, top + size}, color, {u + FontTexelU, v + FontTexelV}});
+            line.vertices.push_back({{left, top + size}, color, {u, v + FontTexelV}});
+            left += size;
+        }
+    }
+
+    void DebugText::Flush()
+    {
+        if (_lineCount == 0) {
+            return;
+        }
+        if (!_font && !_fontFailed) {
+            _fontFailed = !CreateFont();
+        }
+        if (_fontFailed) {
+            FlushFallback();
+            return;
+        }
+
+        _vertices.clear();
+        for (size_t index = 0; index < _lineCount; ++index) {
+            const auto& vertices = _lines[index].vertices;
+            _vertices.insert(_vertices.end(), vertices.begin(), vertices.end());
+        }
+        _lineCount = 0;
+
+        const auto glyphCount = _vertices.size() / 4;
+        // quad indices only depend on the glyph count: extended, never rebuilt
+        for (auto base = static_cast<int>(_indices.size() / 6 * 4); _indices.size() < glyphCount * 6; base += 4) {
+            _indices.insert(_indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+        if (glyphCount == 0) {
+            return;
+        }
+        SDL_RenderGeometry(_state.GetRenderer(), _font.get(),
+            _vertices.data(), static_cast<int>(_vertices.size()),
+            _indices.data(), static_cast<int>(glyphCount * 6));
+        _stats.glyphs += glyphCount;
+        ++_stats.drawCalls;
+    }
+
+    void DebugText::FlushFallback()
+    {
+        auto* renderer = _state.GetRenderer();
+        const auto previousScale = _state.GetScale();
+        const auto previousColor = _state.GetDrawColor();
+        for (size_t index = 0; index < _lineCount; ++index) {
+            const auto& line = _lines[index];
+            _state.SetScale(previousScale.x * line.scale, previousScale.y * line.scale); // on top of the render scale, like the quads
+            _state.SetDrawColor(line.color);
+            SDL_RenderDebugText(renderer, line.position.x, line.position.y, line.text.c_str());
+            ++_stats.drawCalls;
+        }
+        _state.SetScale(previousScale);
+        _state.SetDrawColor(previousColor);
+        _lineCount = 0;
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "Sdl/RenderState.h"
+#include "Sdl/Sdl3Ptr.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Sdl::Render
+{
+    /// Debug text overlay drawn with SDL's 8x8 debug font from a glyph texture (rendered once by
+    /// SDL_RenderDebugText), so all lines of a frame go out in a single SDL_RenderGeometry.
+    /// Lines are matched to the previous frame by print order: a line with the same text, position, scale
+    /// and color reuses its glyph quads, and Printf formats into a reused buffer.
+    /// Falls back to SDL_RenderDebugText per line when render targets aren't supported.
+    class DebugText
+    {
+    public:
+        static constexpr float GlyphSize = SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE;
+
+        struct Stats
+        {
+            uint64_t lines = 0;
+            uint64_t cachedLines = 0; // reused without rebuilding glyph quads
+            uint64_t glyphs = 0;
+            uint64_t drawCalls = 0;
+        };
+
+        explicit DebugText(RenderState& state);
+
+        DebugText(const DebugText&) = delete;
+        DebugText& operator=(const DebugText&) = delete;
+
+        /// Glyph size multiplier (and of positions) for the following lines, applied on top of the current render scale
+        void SetScale(float scale) { _scale = scale; }
+        [[nodiscard]] float GetScale() const { return _scale; }
+        void SetColor(SDL_Color color) { _color = color; }
+        void SetColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = SDL_ALPHA_OPAQUE) { SetColor(SDL_Color{r, g, b, a}); }
+
+        /// Position in unscaled text coordinates (multiplied by the scale)
+        void Print(float x, float y, std::string_view text);
+        void Printf(float x, float y, SDL_PRINTF_FORMAT_STRING const char* format, ...) SDL_PRINTF_VARARG_FUNC(4);
+
+        /// Draw the lines printed since the last flush
+        void Flush();
+
+        [[nodiscard]] const Stats& GetStats() const { return _stats; }
+        void ResetStats() { _stats = {}; }
+
+    private:
+        struct Line
+        {
+            std::string text;
+            SDL_FPoint position{};
+            float scale{};
+            SDL_Color color{};
+            std::vector<SDL_Vertex> vertices; // 4 per glyph
+        };
+
+        RenderState& _state;
+        Texture _font;
+        bool _fontFailed = false;
+
+        float _scale = 1.0f;
+        SDL_Color _color{255, 255, 255, SDL_ALPHA_OPAQUE};
+
+        std::vector<Line> _lines; // cache, the first _lineCount are printed this frame
+        size_t _lineCount = 0;
+        std::string _format;
+
+        std::vector<SDL_Vertex> _vertices;
+        std::vector<int> _indices;
+        Stats _stats;
+
+        bool CreateFont();
+        void BuildQuads(Line& line) const;
+        void FlushFallback();
+    };
+}
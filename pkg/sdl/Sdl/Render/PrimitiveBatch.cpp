@@ -0,0 +1,157 @@
+#include "PrimitiveBatch.h"
+#include "Log/Log.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace Sdl::Render
+{
+    namespace
+    {
+        constexpr int MinCircleSegments = 8;
+        constexpr int MaxCircleSegments = 128;
+        constexpr float CircleSegmentLength = 4.0f; // target outline length per segment (pixels)
+    }
+
+    PrimitiveBatch::PrimitiveBatch(RenderState& state, size_t maxVertices)
+        : _state(state)
+        , _maxVertices(std::max<size_t>(maxVertices, MaxCircleSegments + 1))
+    {
+        _vertices.reserve(_maxVertices);
+        _indices.reserve(_maxVertices * 3 / 2);
+    }
+
+    PrimitiveBatch::~PrimitiveBatch()
+    {
+        if (!_vertices.empty()) {
+            Log::Warn("destroyed with {} vertices not flushed", _vertices.size());
+        }
+    }
+
+    void PrimitiveBatch::SetBlendMode(SDL_BlendMode blendMode)
+    {
+        if (blendMode != _blendMode) {
+            Flush();
+            _blendMode = blendMode;
+        }
+    }
+
+    int PrimitiveBatch::Reserve(SDL_Texture* texture, size_t vertexCount)
+    {
+        if (texture != _texture || _vertices.size() + vertexCount > _maxVertices) {
+            Flush();
+            _texture = texture;
+        }
+        ++_stats.shapes;
+        return static_cast<int>(_vertices.size());
+    }
+
+    void PrimitiveBatch::AddQuadIndices(int base)
+    {
+        _indices.insert(_indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+
+    void PrimitiveBatch::AddRect(const SDL_FRect& rect, SDL_FColor color)
+    {
+        const auto base = Reserve(nullptr, 4);
+        const auto right = rect.x + rect.w;
+        const auto bottom = rect.y + rect.h;
+        _vertices.push_back({{rect.x, rect.y}, color, {}});
+        _vertices.push_back({{right, rect.y}, color, {}});
+        _vertices.push_back({{right, bottom}, color, {}});
+        _vertices.push_back({{rect.x, bottom}, color, {}});
+        AddQuadIndices(base);
+    }
+
+    void PrimitiveBatch::AddQuad(SDL_Texture* texture, const SDL_FRect& rect, const SDL_FRect& uv, SDL_FColor color)
+    {
+        const auto base = Reserve(texture, 4);
+        const auto right = rect.x + rect.w;
+        const auto bottom = rect.y + rect.h;
+        const auto uvRight = uv.x + uv.w;
+        const auto uvBottom = uv.y + uv.h;
+        _vertices.push_back({{rect.x, rect.y}, color, {uv.x, uv.y}});
+        _vertices.push_back({{right, rect.y}, color, {uvRight, uv.y}});
+        _vertices.push_back({{right, bottom}, color, {uvRight, uvBottom}});
+        _vertices.push_back({{rect.x, bottom}, color, {uv.x, uvBottom}});
+        AddQuadIndices(base);
+    }
+
+    void PrimitiveBatch::AddLine(SDL_FPoint from, SDL_FPoint to, float thickness, SDL_FColor color)
+    {
+        const auto dx = to.x - from.x;
+        const auto dy = to.y - from.y;
+        const auto length = std::sqrt(dx * dx + dy * dy);
+        if (length <= 0.0f) {
+            return;
+        }
+        // quad extruded along the line normal
+        const auto scale = thickness * 0.5f / length;
+        const auto nx = -dy * scale;
+        const auto ny = dx * scale;
+
+        const auto base = Reserve(nullptr, 4);
+        _vertices.push_back({{from.x + nx, from.y + ny}, color, {}});
+        _vertices.push_back({{to.x + nx, to.y + ny}, color, {}});
+        _vertices.push_back({{to.x - nx, to.y - ny}, color, {}});
+        _vertices.push_back({{from.x - nx, from.y - ny}, color, {}});
+        AddQuadIndices(base);
+    }
+
+    void PrimitiveBatch::AddCircle(SDL_FPoint center, float radius, SDL_FColor color, int segments)
+    {
+        if (radius <= 0.0f) {
+            return;
+        }
+        if (segments <= 0) {
+            const auto circumference = 2.0f * std::numbers::pi_v<float> * radius;
+            segments = static_cast<int>(circumference / CircleSegmentLength);
+        }
+        segments = std::clamp(segments, MinCircleSegments, MaxCircleSegments);
+
+        const auto base = Reserve(nullptr, static_cast<size_t>(segments) + 1);
+        _vertices.push_back({center, color, {}});
+
+        // rotate the radius vector incrementally instead of sin/cos per vertex
+        const auto step = 2.0f * std::numbers::pi_v<float> / static_cast<float>(segments);
+        const auto cosStep = std::cos(step);
+        const auto sinStep = std::sin(step);
+        auto x = radius;
+        auto y = 0.0f;
+        for (int segment = 0; segment < segments; ++segment) {
+            _vertices.push_back({{center.x + x, center.y + y}, color, {}});
+            const auto nextX = x * cosStep - y * sinStep;
+            y = x * sinStep + y * cosStep;
+            x = nextX;
+
+            const auto next = (segment + 1) % segments;
+            _indices.insert(_indices.end(), {base, base + 1 + segment, base + 1 + next});
+        }
+    }
+
+    void PrimitiveBatch::Flush()
+    {
+        if (_indices.empty()) {
+            _vertices.clear();
+            return;
+        }
+        if (!_texture) {
+            _state.SetBlendMode(_blendMode);
+        }
+        if (!SDL_RenderGeometry(
+                _state.GetRenderer(),
+                _texture,
+                _vertices.data(),
+                static_cast<int>(_vertices.size()),
+                _indices.data(),
+                static_cast<int>(_indices.size())
+            )) {
+            Log::Error("SDL_RenderGeometry failed: {}", SDL_GetError());
+        }
+        ++_stats.drawCalls;
+        _stats.vertices += _vertices.size();
+        _stats.indices += _indices.size();
+        _vertices.clear();
+        _indices.clear();
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Sdl/RenderState.h"
+#include <cstdint>
+#include <vector>
+
+namespace Sdl::Render
+{
+    /// Accumulates colored/textured quads, lines and circles into vertex/index arrays and draws them with
+    /// one SDL_RenderGeometry per run of the same texture and blend mode (draw order is preserved).
+    /// Untextured geometry uses the batch blend mode (renderer draw blend mode), textured - the texture's one.
+    class PrimitiveBatch
+    {
+    public:
+        static constexpr size_t DefaultMaxVertices = 1 << 16; // flush threshold keeping buffers cache-friendly
+
+        struct Stats
+        {
+            uint64_t drawCalls = 0;
+            uint64_t shapes = 0;
+            uint64_t vertices = 0;
+            uint64_t indices = 0;
+        };
+
+        explicit PrimitiveBatch(RenderState& state, size_t maxVertices = DefaultMaxVertices);
+        ~PrimitiveBatch();
+
+        PrimitiveBatch(const PrimitiveBatch&) = delete;
+        PrimitiveBatch& operator=(const PrimitiveBatch&) = delete;
+
+        void SetBlendMode(SDL_BlendMode blendMode);
+
+        void AddRect(const SDL_FRect& rect, SDL_FColor color);
+        void AddRect(const SDL_FRect& rect, SDL_Color color) { AddRect(rect, ToFColor(color)); }
+
+        /// `uv` in normalized texture coordinates
+        void AddQuad(SDL_Texture* texture, const SDL_FRect& rect, const SDL_FRect& uv, SDL_FColor color = White);
+
+        void AddLine(SDL_FPoint from, SDL_FPoint to, float thickness, SDL_FColor color);
+        void AddLine(SDL_FPoint from, SDL_FPoint to, float thickness, SDL_Color color) { AddLine(from, to, thickness, ToFColor(color)); }
+
+        /// Filled circle, `segments` = 0 picks a count from the radius
+        void AddCircle(SDL_FPoint center, float radius, SDL_FColor color, int segments = 0);
+        void AddCircle(SDL_FPoint center, float radius, SDL_Color color, int segments = 0) { AddCircle(center, radius, ToFColor(color), segments); }
+
+        /// Draw the accumulated geometry (also done automatically on texture/blend change and when full)
+        void Flush();
+
+        [[nodiscard]] const Stats& GetStats() const { return _stats; }
+        void ResetStats() { _stats = {}; }
+
+        static constexpr SDL_FColor White{1.0f, 1.0f, 1.0f, 1.0f};
+        static SDL_FColor ToFColor(SDL_Color color)
+        {
+            constexpr float Scale = 1.0f / 255.0f;
+            return {color.r * Scale, color.g * Scale, color.b * Scale, color.a * Scale};
+        }
+
+    private:
+        RenderState& _state;
+        size_t _maxVertices;
+
+        std::vector<SDL_Vertex> _vertices;
+        std::vector<int> _indices;
+        SDL_Texture* _texture{};
+        SDL_BlendMode _blendMode{SDL_BLENDMODE_BLEND};
+
+        Stats _stats;
+
+        /// Switch the run texture (flushing when it changes) and make room for the vertices
+        int Reserve(SDL_Texture* texture, size_t vertexCount);
+        void AddQuadIndices(int base);
+    };
+}
@@ -0,0 +1,106 @@
+#include "SkylinePacker.h"
+#include <algorithm>
+#include <limits>
+
+namespace Sdl::Render
+{
+    SkylinePacker::SkylinePacker(int width, int height)
+        : _width(width)
+        , _height(height)
+    {
+        Reset();
+    }
+
+    void SkylinePacker::Reset()
+    {
+        _skyline.assign(1, Segment{0, 0, _width});
+        _usedArea = 0;
+    }
+
+    std::optional<SkylinePacker::Rect> SkylinePacker::Pack(int w, int h)
+    {
+        if (w <= 0 || h <= 0 || w > _width || h > _height) {
+            return std::nullopt;
+        }
+
+        auto bestIndex = _skyline.size();
+        auto bestBottom = std::numeric_limits<int>::max();
+        auto bestWidth = std::numeric_limits<int>::max();
+        int bestY = 0;
+        for (size_t index = 0; index < _skyline.size(); ++index) {
+            auto y = Fit(index, w, h);
+            if (!y) {
+                continue;
+            }
+            const auto bottom = *y + h;
+            const auto width = _skyline[index].w;
+            if (bottom < bestBottom || (bottom == bestBottom && width < bestWidth)) {
+                bestIndex = index;
+                bestBottom = bottom;
+                bestWidth = width;
+                bestY = *y;
+            }
+        }
+        if (bestIndex == _skyline.size()) {
+            return std::nullopt;
+        }
+
+        const Rect rect{_skyline[bestIndex].x, bestY, w, h};
+        Place(bestIndex, rect);
+        _usedArea += int64_t{w} * h;
+        return rect;
+    }
+
+    std::optional<int> SkylinePacker::Fit(size_t index, int w, int h) const
+    {
+        const auto x = _skyline[index].x;
+        if (x + w > _width) {
+            return std::nullopt;
+        }
+        // rests on the highest segment under its span
+        int y = 0;
+        for (auto remaining = w; remaining > 0; ++index) {
+            if (index >= _skyline.size()) {
+                return std::nullopt;
+            }
+            y = std::max(y, _skyline[index].y);
+            if (y + h > _height) {
+                return std::nullopt;
+            }
+            remaining -= _skyline[index].w;
+        }
+        return y;
+    }
+
+    void SkylinePacker::Place(size_t index, const Rect& rect)
+    {
+        _skyline.insert(_skyline.begin() + static_cast<std::ptrdiff_t>(index), Segment{rect.x, rect.y + rect.h, rect.w});
+
+        // trim the segments now covered by the new one
+        const auto right = rect.x + rect.w;
+        for (auto next = index + 1; next < _skyline.size();) {
+            auto& segment = _skyline[next];
+            if (segment.x >= right) {
+                break;
+            }
+            const auto shrink = right - segment.x;
+            if (segment.w <= shrink) {
+                _skyline.erase(_skyline.begin() + static_cast<std::ptrdiff_t>(next));
+                continue;
+            }
+            segment.x += shrink;
+            segment.w -= shrink;
+            break;
+        }
+
+        // merge neighbours at the same height
+        for (size_t current = 0; current + 1 < _skyline.size();) {
+            if (_skyline[current].y == _skyline[current + 1].y) {
+                _skyline[current].w += _skyline[current + 1].w;
+                _skyline.erase(_skyline.begin() + static_cast<std::ptrdiff_t>(current + 1));
+            } else {
+                ++current;
+            }
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Sdl::Render
+{
+    /// Bottom-left skyline rectangle packer for atlas pages.
+    /// Keeps the top outline of packed rectangles as horizontal segments and places each new rectangle
+    /// where its top edge ends lowest (ties - on the narrowest segment), so pages fill bottom-up with little waste.
+    class SkylinePacker
+    {
+    public:
+        struct Rect
+        {
+            int x, y, w, h;
+        };
+
+        SkylinePacker(int width, int height);
+
+        /// nullopt when the rectangle doesn't fit anymore
+        std::optional<Rect> Pack(int w, int h);
+        void Reset();
+
+        [[nodiscard]] int GetWidth() const { return _width; }
+        [[nodiscard]] int GetHeight() const { return _height; }
+        [[nodiscard]] int64_t GetUsedArea() const { return _usedArea; }
+        [[nodiscard]] float GetOccupancy() const { return static_cast<float>(_usedArea) / static_cast<float>(int64_t{_width} * _height); }
+
+    private:
+        struct Segment
+        {
+            int x, y, w;
+        };
+
+        int _width;
+        int _height;
+        std::vector<Segment> _skyline;
+        int64_t _usedArea = 0;
+
+        /// Top y where a rectangle placed at the segment would rest, nullopt if it doesn't fit there
+        std::optional<int> Fit(size_t index, int w, int h) const;
+        void Place(size_t index, const Rect& rect);
+    };
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "Sdl/Render/PrimitiveBatch.h"
+#include "Sdl/Render/TextureAtlas.h"
+
+namespace Sdl::Render
+{
+    /// Draws atlas sprites through a PrimitiveBatch: consecutive sprites of one page share a draw call,
+    /// so order draws by page (or keep a scene to one page) to get the fewest calls.
+    class SpriteBatch
+    {
+    public:
+        using Sprite = TextureAtlas::Sprite;
+
+        explicit SpriteBatch(RenderState& state, size_t maxVertices = PrimitiveBatch::DefaultMaxVertices)
+            : _batch(state, maxVertices)
+        {}
+
+        /// Stretched to `rect`
+        void Draw(const Sprite& sprite, const SDL_FRect& rect, SDL_FColor tint = PrimitiveBatch::White)
+        {
+            _batch.AddQuad(sprite.texture, rect, sprite.uv, tint);
+        }
+
+        /// Top-left at `position`, sprite size multiplied by `scale`
+        void Draw(const Sprite& sprite, SDL_FPoint position, float scale = 1.0f, SDL_FColor tint = PrimitiveBatch::White)
+        {
+            Draw(sprite, {position.x, position.y, static_cast<float>(sprite.width) * scale, static_cast<float>(sprite.height) * scale}, tint);
+        }
+
+        void Flush() { _batch.Flush(); }
+
+        [[nodiscard]] const PrimitiveBatch::Stats& GetStats() const { return _batch.GetStats(); }
+        void ResetStats() { _batch.ResetStats(); }
+
+    private:
+        PrimitiveBatch _batch;
+    };
+}
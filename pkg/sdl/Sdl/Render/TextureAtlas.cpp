@@ -0,0 +1,157 @@
+#include "TextureAtlas.h"
+#include "Log/Log.h"
+#include <SDL3/SDL_error.h>
+
+namespace Sdl::Render
+{
+    TextureAtlas::TextureAtlas(SDL_Renderer* renderer)
+        : TextureAtlas(renderer, Config{})
+    {}
+
+    TextureAtlas::TextureAtlas(SDL_Renderer* renderer, Config config)
+        : _renderer(renderer)
+        , _config(config)
+    {}
+
+    TextureAtlas::~TextureAtlas()
+    {
+        if (!_pages.empty()) {
+            const auto stats = GetStats();
+            Log::Debug("{} pages, {} sprites, occupancy {:.1f}%", _pages.size(), stats.sprites, stats.occupancy * 100.0f);
+        }
+    }
+
+    void TextureAtlas::Clear()
+    {
+        _pages.clear();
+    }
+
+    std::optional<TextureAtlas::Sprite> TextureAtlas::Add(SDL_Surface* surface)
+    {
+        if (!surface || surface->w <= 0 || surface->h <= 0) {
+            Log::Error("invalid surface");
+            return std::nullopt;
+        }
+        const auto packedWidth = surface->w + 2 * _config.Padding;
+        const auto packedHeight = surface->h + 2 * _config.Padding;
+        if (packedWidth > _config.PageWidth || packedHeight > _config.PageHeight) {
+            Log::Error("surface {}x{} doesn't fit a {}x{} page", surface->w, surface->h, _config.PageWidth, _config.PageHeight);
+            return std::nullopt;
+        }
+
+        // first fit in page order: earlier pages keep filling with small sprites
+        std::optional<SkylinePacker::Rect> packed;
+        Page* page = nullptr;
+        for (auto& candidate : _pages) {
+            if ((packed = candidate.packer.Pack(packedWidth, packedHeight))) {
+                page = &candidate;
+                break;
+            }
+        }
+        if (!page) {
+            page = CreatePage();
+            if (!page) {
+                return std::nullopt;
+            }
+            packed = page->packer.Pack(packedWidth, packedHeight);
+        }
+
+        const SkylinePacker::Rect rect{packed->x + _config.Padding, packed->y + _config.Padding, surface->w, surface->h};
+        if (!Upload(*page, surface, rect)) {
+            return std::nullopt;
+        }
+        ++page->sprites;
+        page->usedPixels += int64_t{surface->w} * surface->h;
+
+        const auto pageWidth = static_cast<float>(_config.PageWidth);
+        const auto pageHeight = static_cast<float>(_config.PageHeight);
+        return Sprite{
+            .texture = page->texture.get(),
+            .uv = {
+                static_cast<float>(rect.x) / pageWidth,
+                static_cast<float>(rect.y) / pageHeight,
+                static_cast<float>(rect.w) / pageWidth,
+                static_cast<float>(rect.h) / pageHeight,
+            },
+            .width = rect.w,
+            .height = rect.h,
+            .page = static_cast<uint32_t>(page - _pages.data()),
+        };
+    }
+
+    TextureAtlas::Page* TextureAtlas::CreatePage()
+    {
+        Texture texture{SDL_CreateTexture(_renderer, PageFormat, SDL_TEXTUREACCESS_STATIC, _config.PageWidth, _config.PageHeight)};
+        if (!texture) {
+            Log::Error("SDL_CreateTexture failed: {}", SDL_GetError());
+            return nullptr;
+        }
+        SDL_SetTextureBlendMode(texture.get(), SDL_BLENDMODE_BLEND);
+        SDL_SetTextureScaleMode(texture.get(), _config.ScaleMode);
+
+        // static texture contents are undefined: clear once so padding stays transparent
+        const std::vector<Uint32> clear(static_cast<size_t>(_config.PageWidth) * static_cast<size_t>(_config.PageHeight), 0);
+        if (!SDL_UpdateTexture(texture.get(), nullptr, clear.data(), _config.PageWidth * static_cast<int>(sizeof(Uint32)))) {
+            Log::Error("SDL_UpdateTexture failed: {}", SDL_GetError());
+            return nullptr;
+        }
+
+        Log::Debug("page #{} {}x{}", _pages.size(), _config.PageWidth, _config.PageHeight);
+        return &_pages.emplace_back(Page{
+            .texture = std::move(texture),
+            .packer = SkylinePacker{_config.PageWidth, _config.PageHeight},
+        });
+    }
+
+    bool TextureAtlas::Upload(Page& page, SDL_Surface* surface, const SkylinePacker::Rect& rect) const
+    {
+        Surface converted;
+        if (surface->format != PageFormat) {
+            converted.reset(SDL_ConvertSurface(surface, PageFormat));
+            if (!converted) {
+                Log::Error("SDL_ConvertSurface failed: {}", SDL_GetError());
+                return false;
+            }
+            surface = converted.get();
+        }
+
+        const SDL_Rect area{rect.x, rect.y, rect.w, rect.h};
+        if (!SDL_LockSurface(surface)) {
+            Log::Error("SDL_LockSurface failed: {}", SDL_GetError());
+            return false;
+        }
+        const auto updated = SDL_UpdateTexture(page.texture.get(), &area, surface->pixels, surface->pitch);
+        SDL_UnlockSurface(surface);
+        if (!updated) {
+            Log::Error("SDL_UpdateTexture failed: {}", SDL_GetError());
+        }
+        return updated;
+    }
+
+    TextureAtlas::PageStats TextureAtlas::GetPageStats(size_t page) const
+    {
+        const auto& source = _pages[page];
+        return {
+            .sprites = source.sprites,
+            .usedPixels = source.usedPixels,
+            .totalPixels = int64_t{source.packer.GetWidth()} * source.packer.GetHeight(),
+            .occupancy = source.packer.GetOccupancy(),
+        };
+    }
+
+    TextureAtlas::PageStats TextureAtlas::GetStats() const
+    {
+        PageStats total;
+        int64_t packedPixels = 0;
+        for (const auto& page : _pages) {
+            total.sprites += page.sprites;
+            total.usedPixels += page.usedPixels;
+            total.totalPixels += int64_t{page.packer.GetWidth()} * page.packer.GetHeight();
+            packedPixels += page.packer.GetUsedArea();
+        }
+        if (total.totalPixels > 0) {
+            total.occupancy = static_cast<float>(packedPixels) / static_cast<float>(total.totalPixels);
+        }
+        return total;
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include "Sdl/Render/SkylinePacker.h"
+#include "Sdl/Sdl3Ptr.h"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Sdl::Render
+{
+    /// Runtime texture atlas: packs surfaces into large RGBA pages (skyline packing) and hands out sprites
+    /// referencing the page texture with normalized UVs, so sprites of one page draw in a single batch.
+    /// A new page is opened when a surface doesn't fit the existing ones; pages are never repacked.
+    class TextureAtlas
+    {
+    public:
+        static constexpr SDL_PixelFormat PageFormat = SDL_PIXELFORMAT_RGBA32;
+
+        struct Config
+        {
+            int PageWidth = 1024;
+            int PageHeight = 1024;
+            int Padding = 1; // transparent gap around each sprite against filtering bleed
+            SDL_ScaleMode ScaleMode = SDL_SCALEMODE_LINEAR;
+        };
+
+        struct Sprite
+        {
+            SDL_Texture* texture{};
+            SDL_FRect uv{}; // normalized within the page
+            int width{};
+            int height{};
+            uint32_t page{};
+
+            explicit operator bool() const { return texture != nullptr; }
+        };
+
+        struct PageStats
+        {
+            size_t sprites = 0;
+            int64_t usedPixels = 0;  // sprite pixels (without padding)
+            int64_t totalPixels = 0;
+            float occupancy = 0.0f;  // packed area (with padding) to page area
+        };
+
+        explicit TextureAtlas(SDL_Renderer* renderer);
+        TextureAtlas(SDL_Renderer* renderer, Config config);
+        ~TextureAtlas();
+
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        /// Copy the surface into a page (converted to the page format), nullopt if it's larger than a page or SDL fails
+        std::optional<Sprite> Add(SDL_Surface* surface);
+
+        /// Drop all pages: previously returned sprites become invalid
+        void Clear();
+
+        [[nodiscard]] size_t GetPageCount() const { return _pages.size(); }
+        [[nodiscard]] SDL_Texture* GetPageTexture(size_t page) const { return _pages[page].texture.get(); }
+        [[nodiscard]] PageStats GetPageStats(size_t page) const;
+        /// Totals over all pages
+        [[nodiscard]] PageStats GetStats() const;
+
+    private:
+        struct Page
+        {
+            Texture texture;
+            SkylinePacker packer;
+            size_t sprites = 0;
+            int64_t usedPixels = 0;
+        };
+
+        SDL_Renderer* _renderer;
+        Config _config;
+        std::vector<Page> _pages;
+
+        Page* CreatePage();
+        bool Upload(Page& page, SDL_Surface* surface, const SkylinePacker::Rect& rect) const;
+    };
+}
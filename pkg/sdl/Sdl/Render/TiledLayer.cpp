@@ -0,0 +1,159 @@
+#include "TiledLayer.h"
+#include "Log/Log.h"
+#include "Sdl/RendererScopes.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Sdl::Render
+{
+    namespace
+    {
+        SDL_Rect Union(const std::optional<SDL_Rect>& a, const SDL_Rect& b)
+        {
+            if (!a) {
+                return b;
+            }
+            SDL_Rect result;
+            SDL_GetRectUnion(&*a, &b, &result);
+            return result;
+        }
+    }
+
+    TiledLayer::TiledLayer(RenderState& state, TexturePool& pool, int width, int height, int tileSize)
+        : _state(state)
+        , _pool(pool)
+        , _tileSize(std::max(tileSize, 1))
+    {
+        Resize(width, height);
+    }
+
+    void TiledLayer::SetContent(DrawFunc draw)
+    {
+        _draw = std::move(draw);
+        Invalidate();
+    }
+
+    void TiledLayer::Resize(int width, int height)
+    {
+        _width = std::max(width, 0);
+        _height = std::max(height, 0);
+        _columns = (_width + _tileSize - 1) / _tileSize;
+        _rows = (_height + _tileSize - 1) / _tileSize;
+        _tiles.clear();
+        _tiles.resize(static_cast<size_t>(_columns) * static_cast<size_t>(_rows));
+        Invalidate();
+    }
+
+    SDL_Rect TiledLayer::TileArea(int column, int row) const
+    {
+        const auto x = column * _tileSize;
+        const auto y = row * _tileSize;
+        return {x, y, std::min(_tileSize, _width - x), std::min(_tileSize, _height - y)};
+    }
+
+    void TiledLayer::Invalidate()
+    {
+        Invalidate({0, 0, _width, _height});
+    }
+
+    void TiledLayer::Invalidate(const SDL_Rect& area)
+    {
+        const SDL_Rect layer{0, 0, _width, _height};
+        SDL_Rect clipped;
+        if (!SDL_GetRectIntersection(&area, &layer, &clipped)) {
+            return;
+        }
+        const auto lastColumn = (clipped.x + clipped.w - 1) / _tileSize;
+        const auto lastRow = (clipped.y + clipped.h - 1) / _tileSize;
+        for (auto row = clipped.y / _tileSize; row <= lastRow; ++row) {
+            for (auto column = clipped.x / _tileSize; column <= lastColumn; ++column) {
+                const auto tileArea = TileArea(column, row);
+                SDL_Rect dirty;
+                SDL_GetRectIntersection(&clipped, &tileArea, &dirty);
+                auto& tile = _tiles[static_cast<size_t>(row * _columns + column)];
+                tile.dirty = Union(tile.dirty, dirty);
+            }
+        }
+    }
+
+    void TiledLayer::Render(SDL_FPoint position)
+    {
+        ++_frame;
+        if (_tiles.empty()) {
+            return;
+        }
+
+        // visible part of the layer in layer coordinates
+        int outputWidth = 0;
+        int outputHeight = 0;
+        SDL_GetCurrentRenderOutputSize(_state.GetRenderer(), &outputWidth, &outputHeight);
+        const auto scale = _state.GetScale();
+        const auto viewWidth = static_cast<float>(outputWidth) / scale.x;
+        const auto viewHeight = static_cast<float>(outputHeight) / scale.y;
+        const auto firstColumn = std::max(static_cast<int>(std::floor(-position.x / static_cast<float>(_tileSize))), 0);
+        const auto firstRow = std::max(static_cast<int>(std::floor(-position.y / static_cast<float>(_tileSize))), 0);
+        const auto endColumn = std::min(static_cast<int>(std::ceil((viewWidth - position.x) / static_cast<float>(_tileSize))), _columns);
+        const auto endRow = std::min(static_cast<int>(std::ceil((viewHeight - position.y) / static_cast<float>(_tileSize))), _rows);
+
+        for (auto row = firstRow; row < endRow; ++row) {
+            for (auto column = firstColumn; column < endColumn; ++column) {
+                auto& tile = _tiles[static_cast<size_t>(row * _columns + column)];
+                const auto area = TileArea(column, row);
+                if (!tile.texture) {
+                    tile.texture = _pool.Acquire(SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, _tileSize, _tileSize);
+                    if (!tile.texture) {
+                        continue;
+                    }
+                    tile.dirty = area; // pooled texture content is arbitrary
+                }
+                if (tile.dirty) {
+                    Redraw(tile, area);
+                }
+
+                const SDL_FRect source{0.0f, 0.0f, static_cast<float>(area.w), static_cast<float>(area.h)};
+                const SDL_FRect destination{
+                    position.x + static_cast<float>(area.x),
+                    position.y + static_cast<float>(area.y),
+                    source.w,
+                    source.h,
+                };
+                SDL_RenderTexture(_state.GetRenderer(), tile.texture.Get(), &source, &destination);
+                tile.renderedFrame = _frame;
+                ++_stats.tilesComposited;
+            }
+        }
+    }
+
+    void TiledLayer::Redraw(Tile& tile, const SDL_Rect& tileArea)
+    {
+        const auto dirty = *tile.dirty;
+        tile.dirty.reset();
+        const SDL_Rect local{dirty.x - tileArea.x, dirty.y - tileArea.y, dirty.w, dirty.h};
+
+        SetTargetScope targetScope{_state, tile.texture.Get()};
+        SetRenderScaleScope scaleScope{_state, 1.0f, 1.0f};
+        SetViewportScope viewportScope{_state, std::nullopt};
+        SetClipRectScope clipScope{_state, local};
+        {
+            // clear just the dirty part: SDL_RenderClear ignores the clip rect
+            SetBlendModeScope blendScope{_state, SDL_BLENDMODE_NONE};
+            SetDrawColorScope colorScope{_state, SDL_Color{0, 0, 0, SDL_ALPHA_TRANSPARENT}};
+            const SDL_FRect clear{static_cast<float>(local.x), static_cast<float>(local.y), static_cast<float>(local.w), static_cast<float>(local.h)};
+            SDL_RenderFillRect(_state.GetRenderer(), &clear);
+        }
+        if (_draw) {
+            _draw(_state, SDL_Point{tileArea.x, tileArea.y}, dirty);
+        }
+        ++_stats.tilesRedrawn;
+        _stats.pixelsRedrawn += static_cast<uint64_t>(dirty.w) * static_cast<uint64_t>(dirty.h);
+    }
+
+    void TiledLayer::ReleaseHidden()
+    {
+        for (auto& tile : _tiles) {
+            if (tile.texture && tile.renderedFrame != _frame) {
+                tile.texture.Release();
+            }
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "Sdl/RenderState.h"
+#include "Sdl/TexturePool.h"
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace Sdl::Render
+{
+    /// Cached layer of mostly static content split into render target tiles (textures from a TexturePool).
+    /// Content is drawn into a tile only when the tile is visible and dirty (Invalidate marks areas of the
+    /// layer, a tile redraws just the union of its dirty areas); every frame Render composites the visible
+    /// tiles, so the per-frame cost follows the visible tile count instead of the content's primitive count.
+    class TiledLayer
+    {
+    public:
+        static constexpr int DefaultTileSize = 256;
+
+        /// Draws the layer content into the current target: layer point p goes to p - origin.
+        /// Only `area` (layer coordinates) needs drawing, the rest is clipped and may be skipped.
+        using DrawFunc = std::function<void(RenderState& state, SDL_Point origin, const SDL_Rect& area)>;
+
+        struct Stats
+        {
+            uint64_t tilesRedrawn = 0;
+            uint64_t tilesComposited = 0;
+            uint64_t pixelsRedrawn = 0;
+        };
+
+        TiledLayer(RenderState& state, TexturePool& pool, int width, int height, int tileSize = DefaultTileSize);
+
+        TiledLayer(const TiledLayer&) = delete;
+        TiledLayer& operator=(const TiledLayer&) = delete;
+
+        void SetContent(DrawFunc draw);
+        /// Changes the layer size, everything becomes dirty
+        void Resize(int width, int height);
+
+        /// Mark the whole layer for redraw
+        void Invalidate();
+        /// Mark an area (layer coordinates) for redraw
+        void Invalidate(const SDL_Rect& area);
+
+        /// Redraw the dirty visible tiles and composite the visible ones with the layer origin at `position`
+        void Render(SDL_FPoint position);
+
+        /// Give back the textures of tiles not composited by the last Render (they get redrawn when visible again)
+        void ReleaseHidden();
+
+        [[nodiscard]] int GetWidth() const { return _width; }
+        [[nodiscard]] int GetHeight() const { return _height; }
+        [[nodiscard]] const Stats& GetStats() const { return _stats; }
+        void ResetStats() { _stats = {}; }
+
+    private:
+        struct Tile
+        {
+            TexturePool::Lease texture;
+            std::optional<SDL_Rect> dirty; // layer coordinates, within the tile area
+            uint64_t renderedFrame = 0;
+        };
+
+        RenderState& _state;
+        TexturePool& _pool;
+        int _tileSize;
+        int _width = 0;
+        int _height = 0;
+        int _columns = 0;
+        int _rows = 0;
+        std::vector<Tile> _tiles;
+        DrawFunc _draw;
+        uint64_t _frame = 0;
+        Stats _stats;
+
+        [[nodiscard]] SDL_Rect TileArea(int column, int row) const;
+        void Redraw(Tile& tile, const SDL_Rect& tileArea);
+    };
+}
@@ -0,0 +1,60 @@
+#include "RenderState.h"
+#include "Log/Log.h"
+
+namespace Sdl
+{
+    RenderState::RenderState(SDL_Renderer* renderer)
+        : _renderer(renderer)
+    {
+        Invalidate();
+    }
+
+    void RenderState::Invalidate()
+    {
+        if (!SDL_GetRenderDrawColor(_renderer, &_drawColor.r, &_drawColor.g, &_drawColor.b, &_drawColor.a)) {
+            Log::Warn("SDL_GetRenderDrawColor failed: {}", SDL_GetError());
+        }
+        if (!SDL_GetRenderDrawBlendMode(_renderer, &_blendMode)) {
+            Log::Warn("SDL_GetRenderDrawBlendMode failed: {}", SDL_GetError());
+        }
+        _target = SDL_GetRenderTarget(_renderer);
+        ReadTargetState();
+    }
+
+    void RenderState::SetTarget(SDL_Texture* target)
+    {
+        if (Skip(target == _target)) {
+            return;
+        }
+        if (!SDL_SetRenderTarget(_renderer, target)) {
+            Log::Error("SDL_SetRenderTarget failed: {}", SDL_GetError());
+        }
+        _target = SDL_GetRenderTarget(_renderer);
+        ReadTargetState();
+    }
+
+    void RenderState::ReadTargetState()
+    {
+        _targetState = {};
+        SDL_GetRenderScale(_renderer, &_targetState.scale.x, &_targetState.scale.y);
+
+        // SDL reports the effective viewport: treat the whole output as "not set" so it follows resizes
+        SDL_Rect viewport{};
+        int outputWidth = 0;
+        int outputHeight = 0;
+        if (SDL_GetRenderViewport(_renderer, &viewport) && SDL_GetCurrentRenderOutputSize(_renderer, &outputWidth, &outputHeight)) {
+            const bool whole = viewport.x == 0 && viewport.y == 0
+                && static_cast<float>(viewport.w) * _targetState.scale.x == static_cast<float>(outputWidth)
+                && static_cast<float>(viewport.h) * _targetState.scale.y == static_cast<float>(outputHeight);
+            if (!whole) {
+                _targetState.viewport = viewport;
+            }
+        }
+
+        if (SDL_RenderClipEnabled(_renderer)) {
+            SDL_Rect clipRect{};
+            SDL_GetRenderClipRect(_renderer, &clipRect);
+            _targetState.clipRect = clipRect;
+        }
+    }
+}
@@ -0,0 +1,121 @@
+#pragma once
+#include <SDL3/SDL_render.h>
+#include <cstdint>
+#include <optional>
+
+namespace Sdl
+{
+    /// Shadow of SDL renderer state: draw color, blend mode, render target and the per-target
+    /// scale, viewport and clip rect. Setters skip calls that wouldn't change anything and getters don't
+    /// query SDL, so per-draw state changes and scope guards are cheap.
+    /// All state changes of the renderer are expected to go through it; call Invalidate after foreign
+    /// code (e.g. a backend) changed the renderer directly.
+    class RenderState
+    {
+    public:
+        struct Stats
+        {
+            uint64_t applied = 0; // state calls passed to SDL
+            uint64_t skipped = 0; // redundant calls filtered out
+        };
+
+        explicit RenderState(SDL_Renderer* renderer);
+
+        [[nodiscard]] SDL_Renderer* GetRenderer() const { return _renderer; }
+
+        /// Re-read the whole state from SDL
+        void Invalidate();
+
+        void SetDrawColor(SDL_Color color)
+        {
+            if (Skip(SameColor(color, _drawColor))) {
+                return;
+            }
+            SDL_SetRenderDrawColor(_renderer, color.r, color.g, color.b, color.a);
+            _drawColor = color;
+        }
+        void SetDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = SDL_ALPHA_OPAQUE) { SetDrawColor(SDL_Color{r, g, b, a}); }
+        [[nodiscard]] SDL_Color GetDrawColor() const { return _drawColor; }
+
+        void SetBlendMode(SDL_BlendMode blendMode)
+        {
+            if (Skip(blendMode == _blendMode)) {
+                return;
+            }
+            SDL_SetRenderDrawBlendMode(_renderer, blendMode);
+            _blendMode = blendMode;
+        }
+        [[nodiscard]] SDL_BlendMode GetBlendMode() const { return _blendMode; }
+
+        void SetScale(SDL_FPoint scale)
+        {
+            if (Skip(scale.x == _targetState.scale.x && scale.y == _targetState.scale.y)) {
+                return;
+            }
+            SDL_SetRenderScale(_renderer, scale.x, scale.y);
+            _targetState.scale = scale;
+        }
+        void SetScale(float x, float y) { SetScale(SDL_FPoint{x, y}); }
+        [[nodiscard]] SDL_FPoint GetScale() const { return _targetState.scale; }
+
+        /// nullopt - whole target
+        void SetViewport(const std::optional<SDL_Rect>& viewport)
+        {
+            if (Skip(SameRect(viewport, _targetState.viewport))) {
+                return;
+            }
+            SDL_SetRenderViewport(_renderer, viewport ? &*viewport : nullptr);
+            _targetState.viewport = viewport;
+        }
+        [[nodiscard]] const std::optional<SDL_Rect>& GetViewport() const { return _targetState.viewport; }
+
+        /// nullopt - clipping disabled
+        void SetClipRect(const std::optional<SDL_Rect>& clipRect)
+        {
+            if (Skip(SameRect(clipRect, _targetState.clipRect))) {
+                return;
+            }
+            SDL_SetRenderClipRect(_renderer, clipRect ? &*clipRect : nullptr);
+            _targetState.clipRect = clipRect;
+        }
+        [[nodiscard]] const std::optional<SDL_Rect>& GetClipRect() const { return _targetState.clipRect; }
+
+        /// nullptr - window. Scale, viewport and clip rect are per target in SDL: they are re-read after switching.
+        void SetTarget(SDL_Texture* target);
+        [[nodiscard]] SDL_Texture* GetTarget() const { return _target; }
+
+        [[nodiscard]] const Stats& GetStats() const { return _stats; }
+
+    private:
+        struct TargetState
+        {
+            SDL_FPoint scale{1.0f, 1.0f};
+            std::optional<SDL_Rect> viewport;
+            std::optional<SDL_Rect> clipRect;
+        };
+
+        SDL_Renderer* _renderer;
+        SDL_Color _drawColor{};
+        SDL_BlendMode _blendMode{SDL_BLENDMODE_NONE};
+        SDL_Texture* _target{};
+        TargetState _targetState;
+        Stats _stats;
+
+        void ReadTargetState();
+
+        bool Skip(bool same)
+        {
+            ++(same ? _stats.skipped : _stats.applied);
+            return same;
+        }
+
+        static bool SameColor(SDL_Color a, SDL_Color b) { return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a; }
+        static bool SameRect(const std::optional<SDL_Rect>& a, const std::optional<SDL_Rect>& b)
+        {
+            if (!a || !b) {
+                return !a && !b;
+            }
+            return a->x == b->x && a->y == b->y && a->w == b->w && a->h == b->h;
+        }
+    };
+}
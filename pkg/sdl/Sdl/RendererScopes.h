@@ -1,21 +1,73 @@
 #pragma once
-#include <SDL3/SDL_render.h>
+#include "Sdl/RenderState.h"
 
 namespace Sdl
 {
-    struct SetRenderScaleScope
+    /// Scope guards changing a piece of renderer state and restoring the previous value from the RenderState shadow
+    template <typename T, T (RenderState::*Getter)() const, void (RenderState::*Setter)(T)>
+    struct RenderStateScope
     {
-        SDL_Renderer* renderer;
-        float previous_x{}, previous_y{};
+        RenderState& state;
+        T previous;
 
-        SetRenderScaleScope(SDL_Renderer* renderer, float x, float y)
-            : renderer(renderer)
+        RenderStateScope(RenderState& state, T value)
+            : state(state)
+            , previous((state.*Getter)())
         {
-            SDL_GetRenderScale(renderer, &previous_x, &previous_y);
-            SDL_SetRenderScale(renderer, x, y);
+            (state.*Setter)(value);
         }
 
-        ~SetRenderScaleScope() { SDL_SetRenderScale(renderer, previous_x, previous_y); }
+        ~RenderStateScope() { (state.*Setter)(previous); }
+
+        RenderStateScope(const RenderStateScope&) = delete;
+        RenderStateScope& operator=(const RenderStateScope&) = delete;
+    };
+
+    using SetDrawColorScope = RenderStateScope<SDL_Color, &RenderState::GetDrawColor, &RenderState::SetDrawColor>;
+    using SetBlendModeScope = RenderStateScope<SDL_BlendMode, &RenderState::GetBlendMode, &RenderState::SetBlendMode>;
+    using SetTargetScope = RenderStateScope<SDL_Texture*, &RenderState::GetTarget, &RenderState::SetTarget>;
+
+    struct SetRenderScaleScope : RenderStateScope<SDL_FPoint, &RenderState::GetScale, &RenderState::SetScale>
+    {
+        SetRenderScaleScope(RenderState& state, float x, float y)
+            : RenderStateScope(state, SDL_FPoint{x, y})
+        {
+        }
+    };
+
+    struct SetViewportScope
+    {
+        RenderState& state;
+        std::optional<SDL_Rect> previous;
+
+        SetViewportScope(RenderState& state, const std::optional<SDL_Rect>& viewport)
+            : state(state)
+            , previous(state.GetViewport())
+        {
+            state.SetViewport(viewport);
+        }
+
+        ~SetViewportScope() { state.SetViewport(previous); }
+
+        SetViewportScope(const SetViewportScope&) = delete;
+        SetViewportScope& operator=(const SetViewportScope&) = delete;
     };
 
+    struct SetClipRectScope
+    {
+        RenderState& state;
+        std::optional<SDL_Rect> previous;
+
+        SetClipRectScope(RenderState& state, const std::optional<SDL_Rect>& clipRect)
+            : state(state)
+            , previous(state.GetClipRect())
+        {
+            state.SetClipRect(clipRect);
+        }
+
+        ~SetClipRectScope() { state.SetClipRect(previous); }
+
+        SetClipRectScope(const SetClipRectScope&) = delete;
+        SetClipRectScope& operator=(const SetClipRectScope&) = delete;
+    };
 }
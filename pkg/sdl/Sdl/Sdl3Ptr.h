@@ -20,4 +20,6 @@ namespace Sdl
 
     using Window = UniquePtr<SDL_Window, SDL_DestroyWindow>;
     using Renderer = UniquePtr<SDL_Renderer, SDL_DestroyRenderer>;
+    using Texture = UniquePtr<SDL_Texture, SDL_DestroyTexture>;
+    using Surface = UniquePtr<SDL_Surface, SDL_DestroySurface>;
 }
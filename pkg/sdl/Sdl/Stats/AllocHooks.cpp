@@ -0,0 +1,99 @@
+// Global operator new/delete replacements counting into AllocTracker (linked only by the //pkg/sdl:alloc_hooks target)
+#include "AllocTracker.h"
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    using Sdl::Stats::AllocTracker;
+
+    [[maybe_unused]] const bool g_hooked = (AllocTracker::SetHooked(), true);
+
+    void* Allocate(std::size_t size) noexcept
+    {
+        AllocTracker::OnAlloc(size);
+        return std::malloc(size ? size : 1);
+    }
+
+    void* AllocateAligned(std::size_t size, std::align_val_t alignment) noexcept
+    {
+        AllocTracker::OnAlloc(size);
+        const auto align = static_cast<std::size_t>(alignment);
+        size = (size + align - 1) / align * align; // aligned_alloc requires a multiple of the alignment
+#if defined(_WIN32)
+        return _aligned_malloc(size ? size : align, align);
+#else
+        return std::aligned_alloc(align, size ? size : align);
+#endif
+    }
+
+    void Free(void* ptr) noexcept
+    {
+        if (ptr) {
+            AllocTracker::OnFree();
+            std::free(ptr);
+        }
+    }
+
+    void FreeAligned(void* ptr) noexcept
+    {
+        if (ptr) {
+            AllocTracker::OnFree();
+#if defined(_WIN32)
+            _aligned_free(ptr);
+#else
+            std::free(ptr);
+#endif
+        }
+    }
+
+    void* AllocateOrThrow(std::size_t size)
+    {
+        while (true) {
+            if (auto* ptr = Allocate(size)) {
+                return ptr;
+            }
+            auto handler = std::get_new_handler();
+            if (!handler) {
+                throw std::bad_alloc{};
+            }
+            handler();
+        }
+    }
+
+    void* AllocateAlignedOrThrow(std::size_t size, std::align_val_t alignment)
+    {
+        while (true) {
+            if (auto* ptr = AllocateAligned(size, alignment)) {
+                return ptr;
+            }
+            auto handler = std::get_new_handler();
+            if (!handler) {
+                throw std::bad_alloc{};
+            }
+            handler();
+        }
+    }
+}
+
+void* operator new(std::size_t size) { return AllocateOrThrow(size); }
+void* operator new[](std::size_t size) { return AllocateOrThrow(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return Allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return Allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return AllocateAlignedOrThrow(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return AllocateAlignedOrThrow(size, alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return AllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return AllocateAligned(size, alignment); }
+
+void operator delete(void* ptr) noexcept { Free(ptr); }
+void operator delete[](void* ptr) noexcept { Free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { Free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { Free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { Free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { Free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(ptr); }
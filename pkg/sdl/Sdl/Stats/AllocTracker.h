@@ -0,0 +1,50 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Sdl::Stats
+{
+    /// Heap allocation counters of the calling thread.
+    /// Fed by the global operator new/delete replacements of the //pkg/sdl:alloc_hooks target (opt-in: apps depending
+    /// on it get the counters, without it they stay zero) and by the ImGui allocator functions Im::Deputy installs.
+    /// Counting is a thread-local increment; the runner turns it into per-frame numbers and trace scopes into
+    /// per-scope ones.
+    class AllocTracker
+    {
+    public:
+        struct Counters
+        {
+            uint64_t allocations;
+            uint64_t bytes; // requested by the allocations
+            uint64_t frees;
+
+            [[nodiscard]] Counters Since(const Counters& begin) const
+            {
+                return {
+                    .allocations = allocations - begin.allocations,
+                    .bytes = bytes - begin.bytes,
+                    .frees = frees - begin.frees,
+                };
+            }
+        };
+
+        /// Whether the global hooks are linked (counters are meaningful)
+        [[nodiscard]] static bool IsHooked() { return _hooked.load(std::memory_order_relaxed); }
+        static void SetHooked() { _hooked.store(true, std::memory_order_relaxed); }
+
+        [[nodiscard]] static const Counters& GetThreadCounters() { return _thread; }
+
+        static void OnAlloc(size_t size)
+        {
+            ++_thread.allocations;
+            _thread.bytes += size;
+        }
+
+        static void OnFree() { ++_thread.frees; }
+
+    private:
+        static inline std::atomic<bool> _hooked{false};
+        static inline thread_local Counters _thread{};
+    };
+}
@@ -0,0 +1,207 @@
+#include "FrameProfiler.h"
+#include "Json.h"
+#include "Log/Log.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <utility>
+
+namespace Sdl::Stats
+{
+    namespace
+    {
+        thread_local FrameProfiler* g_currentProfiler = nullptr;
+
+        constexpr std::array PhaseNames = {
+            "update",
+            "imgui_build",
+            "render_submit",
+            "present",
+        };
+        static_assert(PhaseNames.size() == FrameProfiler::PhaseCount);
+
+        float Percentile(const std::vector<float>& sorted, float fraction)
+        {
+            if (sorted.empty()) {
+                return 0.0f;
+            }
+            auto index = static_cast<size_t>(std::ceil(fraction * static_cast<float>(sorted.size())));
+            index = std::clamp<size_t>(index, 1, sorted.size()) - 1;
+            return sorted[index];
+        }
+
+        void WriteSummary(std::ostream& out, const char* name, std::vector<float> seconds)
+        {
+            std::ranges::sort(seconds);
+            double sum = 0.0;
+            for (auto value : seconds) {
+                sum += value;
+            }
+            const auto mean = seconds.empty() ? 0.0 : sum / static_cast<double>(seconds.size());
+            out << "    \"" << name << "\": {"
+                << "\"mean_ms\": " << mean * 1000.0
+                << ", \"p50_ms\": " << Percentile(seconds, 0.50f) * 1000.0f
+                << ", \"p95_ms\": " << Percentile(seconds, 0.95f) * 1000.0f
+                << ", \"p99_ms\": " << Percentile(seconds, 0.99f) * 1000.0f
+                << ", \"max_ms\": " << (seconds.empty() ? 0.0f : seconds.back()) * 1000.0f
+                << "}";
+        }
+
+        void WriteAllocations(std::ostream& out, const std::vector<FrameProfiler::FrameRecord>& records, uint64_t warmupFrames)
+        {
+            uint64_t steadyFrames = 0;
+            uint64_t allocatingFrames = 0;
+            AllocTracker::Counters steady{};
+            uint64_t maxFrameAllocations = 0;
+            for (const auto& record : records) {
+                if (record.index < warmupFrames) {
+                    continue;
+                }
+                ++steadyFrames;
+                allocatingFrames += record.allocations.allocations > 0;
+                steady.allocations += record.allocations.allocations;
+                steady.bytes += record.allocations.bytes;
+                steady.frees += record.allocations.frees;
+                maxFrameAllocations = std::max(maxFrameAllocations, record.allocations.allocations);
+            }
+            out << "  \"allocations\": {"
+                << "\"hooked\": " << (AllocTracker::IsHooked() ? "true" : "false")
+                << ", \"warmup_frames\": " << warmupFrames
+                << ", \"steady_frames\": " << steadyFrames
+                << ", \"allocating_frames\": " << allocatingFrames
+                << ", \"steady_allocations\": " << steady.allocations
+                << ", \"steady_bytes\": " << steady.bytes
+                << ", \"steady_frees\": " << steady.frees
+                << ", \"max_frame_allocations\": " << maxFrameAllocations
+                << "}\n";
+        }
+    }
+
+    const char* ToString(FramePhase phase)
+    {
+        const auto index = static_cast<size_t>(phase);
+        return index < PhaseNames.size() ? PhaseNames[index] : "unknown";
+    }
+
+    FrameProfiler::Scope::Scope(FramePhase phase)
+        : _profiler(g_currentProfiler)
+        , _phase(phase)
+    {
+        if (!_profiler) {
+            return;
+        }
+        _parent = std::exchange(_profiler->_scope, this);
+        _start = Clock::now();
+    }
+
+    FrameProfiler::Scope::~Scope()
+    {
+        if (!_profiler) {
+            return;
+        }
+        const auto elapsed = Clock::now() - _start;
+        _profiler->Add(_phase, elapsed - _nested);
+        if (_parent) {
+            _parent->_nested += elapsed;
+        }
+        _profiler->_scope = _parent;
+    }
+
+    FrameProfiler::FrameProfiler(size_t capacity)
+        : _capacity(capacity)
+    {
+        _records.reserve(capacity);
+    }
+
+    FrameProfiler* FrameProfiler::Current()
+    {
+        return g_currentProfiler;
+    }
+
+    void FrameProfiler::SetCurrent(FrameProfiler* profiler)
+    {
+        g_currentProfiler = profiler;
+    }
+
+    void FrameProfiler::BeginFrame(uint64_t index)
+    {
+        _frame = {.index = index, .seconds = {}, .allocations = {}};
+        _inFrame = true;
+    }
+
+    void FrameProfiler::SetFrameAllocations(const AllocTracker::Counters& allocations)
+    {
+        _frame.allocations = allocations;
+    }
+
+    void FrameProfiler::EndFrame()
+    {
+        if (!_inFrame) {
+            return;
+        }
+        _inFrame = false;
+        if (_records.size() < _capacity) {
+            _records.push_back(_frame);
+        } else if (_droppedFrames++ == 0) {
+            Log::Warn("frame profiler: {} records are full, later frames are dropped", _capacity);
+        }
+    }
+
+    void FrameProfiler::Add(FramePhase phase, Clock::duration duration)
+    {
+        _frame.seconds[static_cast<size_t>(phase)] += std::chrono::duration<float>(duration).count();
+    }
+
+    bool FrameProfiler::WriteReport(const std::string& path, const std::string& name, uint64_t warmupFrames) const
+    {
+        std::ofstream out{path};
+        if (!out) {
+            Log::Error("cannot open report: {}", path);
+            return false;
+        }
+
+        const auto csv = path.ends_with(".csv");
+        if (csv) {
+            out << "frame";
+            for (auto* phaseName : PhaseNames) {
+                out << ',' << phaseName << "_ms";
+            }
+            out << ",total_ms,allocations,allocated_bytes\n";
+            for (const auto& record : _records) {
+                out << record.index;
+                float total = 0.0f;
+                for (auto seconds : record.seconds) {
+                    out << ',' << seconds * 1000.0f;
+                    total += seconds;
+                }
+                out << ',' << total * 1000.0f << ',' << record.allocations.allocations << ',' << record.allocations.bytes << '\n';
+            }
+        } else {
+            out << "{\n  \"name\": ";
+            Json::WriteString(out, name);
+            out << ",\n  \"frames\": " << _records.size() << ",\n  \"dropped_frames\": " << _droppedFrames << ",\n  \"phases\": {\n";
+            std::vector<float> totals(_records.size());
+            for (size_t phase = 0; phase < PhaseCount; ++phase) {
+                std::vector<float> seconds;
+                seconds.reserve(_records.size());
+                for (size_t index = 0; index < _records.size(); ++index) {
+                    seconds.push_back(_records[index].seconds[phase]);
+                    totals[index] += _records[index].seconds[phase];
+                }
+                WriteSummary(out, PhaseNames[phase], std::move(seconds));
+                out << ",\n";
+            }
+            WriteSummary(out, "total", std::move(totals));
+            out << "\n  },\n";
+            WriteAllocations(out, _records, warmupFrames);
+            out << "}\n";
+        }
+
+        if (!out) {
+            Log::Error("failed to write report: {}", path);
+            return false;
+        }
+        Log::Info("report written: {} ({} frames)", path, _records.size());
+        return true;
+    }
+}
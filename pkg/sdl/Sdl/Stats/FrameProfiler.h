@@ -0,0 +1,88 @@
+#pragma once
+#include "Sdl/Stats/AllocTracker.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Sdl::Stats
+{
+    enum class FramePhase : uint8_t
+    {
+        Update, // handler update and pumped work (excluding nested phases below)
+        ImGuiBuild, // ImGui NewFrame/Render (draw lists generation)
+        RenderSubmit, // draw data submission (geometry, ImGui draw data)
+        Present, // frame capture readback and SDL_RenderPresent
+        Count,
+    };
+
+    const char* ToString(FramePhase phase);
+
+    /// Per-frame phase timings recorded by the harness mode of the runner.
+    /// Phases are measured with RAII scopes: time of a nested scope is excluded from the enclosing one,
+    /// so the phase times of a frame add up to the frame CPU time spent inside the scopes.
+    /// Scopes are no-op while no profiler is active on the thread (the default for normal runs).
+    /// Records are allocated up front for `capacity` frames, so recording doesn't allocate inside the measured
+    /// frames; frames beyond it are only counted as dropped.
+    class FrameProfiler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        static constexpr size_t PhaseCount = static_cast<size_t>(FramePhase::Count);
+
+        struct FrameRecord
+        {
+            uint64_t index;
+            std::array<float, PhaseCount> seconds;
+            AllocTracker::Counters allocations; // loop thread heap allocations of the frame
+        };
+
+        class Scope
+        {
+        public:
+            explicit Scope(FramePhase phase);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            FrameProfiler* _profiler;
+            Scope* _parent{};
+            FramePhase _phase;
+            Clock::time_point _start;
+            Clock::duration _nested{};
+        };
+
+        explicit FrameProfiler(size_t capacity);
+
+        /// Profiler receiving scopes of the calling thread (nullptr when inactive)
+        static FrameProfiler* Current();
+        /// Make it current for the calling thread (nullptr to deactivate)
+        static void SetCurrent(FrameProfiler* profiler);
+
+        void BeginFrame(uint64_t index);
+        void SetFrameAllocations(const AllocTracker::Counters& allocations);
+        void EndFrame();
+
+        [[nodiscard]] const std::vector<FrameRecord>& GetRecords() const { return _records; }
+        [[nodiscard]] uint64_t GetDroppedFrames() const { return _droppedFrames; }
+
+        /// Write per-frame records as CSV (`.csv` extension) or as JSON (otherwise) a summary of them:
+        /// frame count, per-phase percentiles and allocations, w/o the records themselves.
+        /// Allocations of the frames after warmup are summed up as the steady state ones in the JSON summary.
+        bool WriteReport(const std::string& path, const std::string& name, uint64_t warmupFrames = 0) const;
+
+    private:
+        std::vector<FrameRecord> _records;
+        size_t _capacity;
+        uint64_t _droppedFrames{};
+        FrameRecord _frame{};
+        Scope* _scope{};
+        bool _inFrame{};
+
+        void Add(FramePhase phase, Clock::duration duration);
+    };
+}
@@ -0,0 +1,140 @@
+#include "FrameStats.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Sdl::Stats
+{
+    FrameStats::FrameStats(size_t capacity, float budgetSeconds)
+        : _budgetSeconds(budgetSeconds)
+        , _frames(std::max<size_t>(capacity, 1))
+        , _maxQueue(_frames.size())
+    {
+    }
+
+    void FrameStats::AddFrame(float deltaSeconds)
+    {
+        if (!(deltaSeconds > 0.0f)) {
+            return;
+        }
+
+        if (_sampleCount == _frames.size()) {
+            Evict(_frames[_index]);
+        } else {
+            ++_sampleCount;
+        }
+        _frames[_index] = deltaSeconds;
+        _index = (_index + 1) % _frames.size();
+        ++_totalFrameCount;
+
+        _sum += deltaSeconds;
+        _sumSquares += static_cast<double>(deltaSeconds) * deltaSeconds;
+        ++_buckets[BucketIndex(deltaSeconds)];
+        if (deltaSeconds > _budgetSeconds) {
+            ++_overBudgetCount;
+            ++_totalOverBudgetCount;
+        }
+        PushMax(deltaSeconds);
+    }
+
+    void FrameStats::Reset()
+    {
+        _index = 0;
+        _sampleCount = 0;
+        _sum = 0.0;
+        _sumSquares = 0.0;
+        _buckets = {};
+        _maxHead = 0;
+        _maxCount = 0;
+        _overBudgetCount = 0;
+        _totalOverBudgetCount = 0;
+        _totalFrameCount = 0;
+    }
+
+    float FrameStats::GetAverageSeconds() const
+    {
+        if (_sampleCount == 0) {
+            return 0.0f;
+        }
+        return static_cast<float>(_sum / static_cast<double>(_sampleCount));
+    }
+
+    float FrameStats::GetAverageFps() const
+    {
+        if (_sampleCount == 0 || _sum <= 0.0) {
+            return 0.0f;
+        }
+        return static_cast<float>(static_cast<double>(_sampleCount) / _sum);
+    }
+
+    float FrameStats::GetJitterSeconds() const
+    {
+        if (_sampleCount < 2) {
+            return 0.0f;
+        }
+        const auto count = static_cast<double>(_sampleCount);
+        const auto mean = _sum / count;
+        const auto variance = std::max(0.0, _sumSquares / count - mean * mean); // running sums may drift slightly below 0
+        return static_cast<float>(std::sqrt(variance));
+    }
+
+    float FrameStats::GetPercentileSeconds(float fraction) const
+    {
+        if (_sampleCount == 0) {
+            return 0.0f;
+        }
+        const auto target = static_cast<size_t>(std::ceil(std::clamp(fraction, 0.0f, 1.0f) * static_cast<float>(_sampleCount)));
+        size_t accumulated = 0;
+        for (size_t index = 0; index < BucketCount; ++index) {
+            accumulated += _buckets[index];
+            if (accumulated >= std::max<size_t>(target, 1)) {
+                return std::min(BucketUpperBound(index), GetMaxSeconds());
+            }
+        }
+        return GetMaxSeconds();
+    }
+
+    float FrameStats::GetMaxSeconds() const
+    {
+        return _maxCount > 0 ? _maxQueue[_maxHead].seconds : 0.0f;
+    }
+
+    size_t FrameStats::BucketIndex(float seconds)
+    {
+        if (seconds <= MinBucketSeconds) {
+            return 0;
+        }
+        const auto octaves = std::log2(seconds / MinBucketSeconds);
+        const auto index = static_cast<size_t>(octaves * static_cast<float>(BucketsPerOctave));
+        return std::min(index, BucketCount - 1);
+    }
+
+    float FrameStats::BucketUpperBound(size_t index)
+    {
+        return MinBucketSeconds * std::exp2(static_cast<float>(index + 1) / static_cast<float>(BucketsPerOctave));
+    }
+
+    void FrameStats::Evict(float seconds)
+    {
+        _sum -= seconds;
+        _sumSquares -= static_cast<double>(seconds) * seconds;
+        --_buckets[BucketIndex(seconds)];
+        if (seconds > _budgetSeconds) {
+            --_overBudgetCount;
+        }
+    }
+
+    void FrameStats::PushMax(float seconds)
+    {
+        // drop the front once it leaves the window, then entries not greater than the new one from the back
+        const auto capacity = _maxQueue.size();
+        if (_maxCount > 0 && _maxQueue[_maxHead].frame + capacity <= _totalFrameCount) {
+            _maxHead = (_maxHead + 1) % capacity;
+            --_maxCount;
+        }
+        while (_maxCount > 0 && _maxQueue[(_maxHead + _maxCount - 1) % capacity].seconds <= seconds) {
+            --_maxCount;
+        }
+        _maxQueue[(_maxHead + _maxCount) % capacity] = {.frame = _totalFrameCount, .seconds = seconds};
+        ++_maxCount;
+    }
+}
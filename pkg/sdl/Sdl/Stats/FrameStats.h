@@ -0,0 +1,81 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Sdl::Stats
+{
+    /// Frame time statistics over a sliding window of the last frames.
+    /// Adding a frame and every query are constant-time and allocation-free (buffers are sized in constructor):
+    /// - running sums for average FPS and jitter (standard deviation of frame time)
+    /// - log-scale histogram for percentiles (bucket resolution ~9%, clamped to the exact window max)
+    /// - monotonic queue for the exact window max
+    /// - counts of frames over the frame budget (in window and since reset)
+    class FrameStats
+    {
+    public:
+        static constexpr size_t DefaultCapacity = 120;
+        static constexpr float DefaultBudgetSeconds = 1.0f / 60.0f;
+
+        /// Histogram layout: BucketsPerOctave log2 sub-buckets starting from MinBucketSeconds
+        static constexpr size_t BucketsPerOctave = 8;
+        static constexpr size_t BucketCount = 16 * BucketsPerOctave; // 0.1 ms .. ~6.5 s
+        static constexpr float MinBucketSeconds = 0.0001f;
+
+        explicit FrameStats(size_t capacity = DefaultCapacity, float budgetSeconds = DefaultBudgetSeconds);
+
+        void AddFrame(float deltaSeconds);
+        void Reset();
+
+        [[nodiscard]] size_t GetCapacity() const { return _frames.size(); }
+        [[nodiscard]] size_t GetSampleCount() const { return _sampleCount; }
+        [[nodiscard]] float GetBudgetSeconds() const { return _budgetSeconds; }
+
+        [[nodiscard]] float GetAverageSeconds() const;
+        [[nodiscard]] float GetAverageFps() const;
+        /// Standard deviation of frame time in window
+        [[nodiscard]] float GetJitterSeconds() const;
+        /// Upper bound of the histogram bucket holding the given fraction (0..1) of window frames
+        [[nodiscard]] float GetPercentileSeconds(float fraction) const;
+        [[nodiscard]] float GetMaxSeconds() const;
+
+        /// Frames over budget in window
+        [[nodiscard]] size_t GetOverBudgetCount() const { return _overBudgetCount; }
+        /// Frames over budget since construction/reset
+        [[nodiscard]] uint64_t GetTotalOverBudgetCount() const { return _totalOverBudgetCount; }
+        [[nodiscard]] uint64_t GetTotalFrameCount() const { return _totalFrameCount; }
+
+    private:
+        struct MaxEntry
+        {
+            uint64_t frame;
+            float seconds;
+        };
+
+        float _budgetSeconds;
+
+        std::vector<float> _frames; // ring of window frame times
+        size_t _index = 0;
+        size_t _sampleCount = 0;
+
+        double _sum = 0.0;
+        double _sumSquares = 0.0;
+
+        std::array<uint32_t, BucketCount> _buckets{};
+
+        std::vector<MaxEntry> _maxQueue; // ring of decreasing frame times (front is the window max)
+        size_t _maxHead = 0;
+        size_t _maxCount = 0;
+
+        size_t _overBudgetCount = 0;
+        uint64_t _totalOverBudgetCount = 0;
+        uint64_t _totalFrameCount = 0;
+
+        static size_t BucketIndex(float seconds);
+        static float BucketUpperBound(size_t index);
+
+        void Evict(float seconds);
+        void PushMax(float seconds);
+    };
+}
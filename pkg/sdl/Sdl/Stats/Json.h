@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdio>
+#include <ostream>
+#include <string_view>
+
+namespace Sdl::Stats::Json
+{
+    /// Quoted JSON string: quotes, backslashes and control characters are escaped (names from titles/environment)
+    inline void WriteString(std::ostream& out, std::string_view text)
+    {
+        out << '"';
+        for (const char c : text) {
+            switch (c) {
+                case '"':
+                case '\\':
+                    out << '\\' << c;
+                    break;
+                case '\n':
+                    out << "\\n";
+                    break;
+                case '\t':
+                    out << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                        out << escaped;
+                    } else {
+                        out << c;
+                    }
+                    break;
+            }
+        }
+        out << '"';
+    }
+}
@@ -0,0 +1,121 @@
+#include "StartupTrace.h"
+#include "Log/Log.h"
+#include <SDL3/SDL_events.h>
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_timer.h>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace Sdl::Stats
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        // earliest timestamp available without platform process APIs
+        const auto g_staticInitTime = Clock::now();
+        const auto g_staticInitSystemTime = std::chrono::system_clock::now();
+
+        constexpr size_t MarkCount = static_cast<size_t>(StartupMark::Count);
+        constexpr std::array<const char*, MarkCount> MarkNames = {
+            "process_start",
+            "boot_init",
+            "sdl_init",
+            "window",
+            "renderer",
+            "handler_start",
+            "first_present",
+            "exit",
+        };
+
+        std::array<std::optional<Clock::time_point>, MarkCount> g_marks{};
+        bool g_finished = false;
+
+        const char* GetReportPath()
+        {
+            static const char* path = SDL_getenv("TX_STARTUP_REPORT");
+            return path;
+        }
+
+        /// Offset from launch to static initialization, when the launch time is provided by the runner
+        std::optional<Clock::duration> GetLaunchOffset()
+        {
+            const auto* text = SDL_getenv("TX_STARTUP_LAUNCH_NS");
+            if (!text || !*text) {
+                return std::nullopt;
+            }
+            const auto launchNs = std::chrono::nanoseconds{SDL_strtoll(text, nullptr, 10)};
+            const auto launch = std::chrono::system_clock::time_point{std::chrono::duration_cast<std::chrono::system_clock::duration>(launchNs)};
+            return std::chrono::duration_cast<Clock::duration>(g_staticInitSystemTime - launch);
+        }
+    }
+
+    const char* ToString(StartupMark mark)
+    {
+        const auto index = static_cast<size_t>(mark);
+        return index < MarkNames.size() ? MarkNames[index] : "unknown";
+    }
+
+    void StartupTrace::Mark(StartupMark mark)
+    {
+        auto& slot = g_marks[static_cast<size_t>(mark)];
+        if (slot) {
+            return;
+        }
+        slot = mark == StartupMark::ProcessStart ? g_staticInitTime : Clock::now();
+
+        if (mark == StartupMark::FirstPresent && IsEnabled()) {
+            SDL_Event event{};
+            event.type = SDL_EVENT_QUIT;
+            event.common.timestamp = SDL_GetTicksNS();
+            SDL_PushEvent(&event);
+        }
+    }
+
+    bool StartupTrace::IsEnabled()
+    {
+        const auto* path = GetReportPath();
+        return path && *path;
+    }
+
+    void StartupTrace::Finish(std::string_view appName)
+    {
+        Mark(StartupMark::ProcessStart);
+        Mark(StartupMark::Exit);
+        if (!IsEnabled() || std::exchange(g_finished, true)) {
+            return;
+        }
+
+        const auto launchOffset = GetLaunchOffset();
+        const auto origin = g_staticInitTime - launchOffset.value_or(Clock::duration::zero());
+
+        std::string line = "{\"app\": \"";
+        line += appName;
+        line += launchOffset ? "\", \"origin\": \"launch\", \"ms\": {" : "\", \"origin\": \"static_init\", \"ms\": {";
+        bool first = true;
+        for (size_t index = 0; index < MarkCount; ++index) {
+            if (!g_marks[index]) {
+                continue;
+            }
+            const auto ms = std::chrono::duration<double, std::milli>(*g_marks[index] - origin).count();
+            line += first ? "\"" : ", \"";
+            line += MarkNames[index];
+            line += "\": ";
+            line += std::to_string(ms);
+            first = false;
+        }
+        line += "}}";
+
+        std::ofstream out{GetReportPath(), std::ios::app};
+        out << line << '\n';
+        if (!out) {
+            Log::Error("failed to write startup report: {}", GetReportPath());
+            return;
+        }
+        Log::Debug("startup: {}", line);
+    }
+}
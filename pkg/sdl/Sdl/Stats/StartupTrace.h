@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace Sdl::Stats
+{
+    enum class StartupMark : uint8_t
+    {
+        ProcessStart, // static initialization of the binary (or launch time passed by the runner script)
+        BootInit,
+        SdlInit,
+        Window,
+        Renderer,
+        HandlerStart, // handler Start completed (fonts loaded)
+        FirstPresent,
+        Exit,
+        Count,
+    };
+
+    const char* ToString(StartupMark mark);
+
+    /// Time-to-first-frame instrumentation.
+    /// Marks are cheap timestamps (only the first one of each kind is kept) and always recorded.
+    /// The instrumented launch mode is enabled by TX_STARTUP_REPORT=<file>:
+    /// - the app quits by itself after the first present (SDL_EVENT_QUIT is pushed)
+    /// - Finish appends a JSON line with marks in ms to the file
+    /// - TX_STARTUP_LAUNCH_NS=<unix epoch ns> makes marks relative to the launch instead of static initialization
+    class StartupTrace
+    {
+    public:
+        static void Mark(StartupMark mark);
+        [[nodiscard]] static bool IsEnabled();
+
+        /// Mark exit and write the report line (once) in the instrumented launch mode
+        static void Finish(std::string_view appName);
+    };
+}
@@ -0,0 +1,274 @@
+#include "Trace.h"
+#include "Json.h"
+#include "Log/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Sdl::Stats
+{
+    namespace
+    {
+        enum class EventType : uint8_t
+        {
+            Complete,
+            Counter,
+            FlowBegin,
+            FlowEnd,
+        };
+
+        struct Event
+        {
+            const char* name;
+            int64_t timeNs;
+            int64_t durationNs; // Complete
+            double value; // Counter
+            uint64_t id; // Flow*
+            uint64_t allocations; // Complete
+            uint64_t allocatedBytes; // Complete
+            EventType type;
+        };
+
+        /// Event storage of one thread and session: written by the owning thread only,
+        /// read by WriteJson up to the published count
+        struct SessionEvents
+        {
+            SessionEvents(uint64_t session, size_t capacity)
+                : session(session)
+                , capacity(capacity)
+                , events(std::make_unique_for_overwrite<Event[]>(capacity)) // pages are committed as they're written
+            {}
+
+            const uint64_t session;
+            const size_t capacity;
+            std::unique_ptr<Event[]> events;
+            std::atomic<size_t> count{0};
+            std::atomic<uint64_t> dropped{0};
+            SessionEvents* nextRetired = nullptr;
+        };
+
+        /// Storage is allocated by Start and registration (under g_mutex), never by Record: the owning thread
+        /// only swaps `pending` in when it sees a new session and pushes the previous storage to `retired`,
+        /// which is freed under g_mutex, so WriteJson never reads storage that is freed or rewound.
+        struct ThreadBuffer
+        {
+            uint32_t index{};
+            std::string name; // guarded by g_mutex
+            std::atomic<SessionEvents*> current{nullptr};
+            std::atomic<SessionEvents*> pending{nullptr};
+            std::atomic<SessionEvents*> retired{nullptr}; // stack linked by nextRetired
+
+            ~ThreadBuffer()
+            {
+                delete current.load(std::memory_order_relaxed);
+                delete pending.load(std::memory_order_relaxed);
+                FreeRetired();
+            }
+
+            /// Requires g_mutex (or no owning thread anymore)
+            void FreeRetired()
+            {
+                for (auto* events = retired.exchange(nullptr, std::memory_order_acquire); events;) {
+                    delete std::exchange(events, events->nextRetired);
+                }
+            }
+
+            /// Owning thread, lock-free
+            void Retire(SessionEvents* events)
+            {
+                events->nextRetired = retired.load(std::memory_order_relaxed);
+                while (!retired.compare_exchange_weak(events->nextRetired, events, std::memory_order_release, std::memory_order_relaxed)) {}
+            }
+        };
+
+        std::mutex g_mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> g_buffers; // kept after thread exit for the dump
+        std::atomic<uint64_t> g_session{0};
+        std::atomic<uint64_t> g_unready{0}; // events of threads w/o storage for the session, dropped
+        std::atomic<size_t> g_capacity{Trace::DefaultThreadCapacity};
+        std::atomic<int64_t> g_originNs{0};
+        thread_local ThreadBuffer* t_buffer = nullptr;
+
+        /// Replaces the storage prepared for the owning thread, requires g_mutex
+        void Prepare(ThreadBuffer& buffer, uint64_t session, size_t capacity)
+        {
+            buffer.FreeRetired();
+            delete buffer.pending.exchange(new SessionEvents{session, capacity}, std::memory_order_acq_rel);
+        }
+
+        void Record(const Event& event)
+        {
+            auto* buffer = t_buffer;
+            if (!buffer) {
+                g_unready.fetch_add(1, std::memory_order_relaxed); // not registered by SetThreadName
+                return;
+            }
+            auto* events = buffer->current.load(std::memory_order_relaxed);
+            if (!events || events->session != g_session.load(std::memory_order_acquire)) {
+                // first event of the thread in this session: take the storage Start prepared for it
+                auto* next = buffer->pending.exchange(nullptr, std::memory_order_acq_rel);
+                if (!next) {
+                    g_unready.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                buffer->current.store(next, std::memory_order_release);
+                if (events) {
+                    buffer->Retire(events);
+                }
+                events = next;
+            }
+
+            const auto count = events->count.load(std::memory_order_relaxed);
+            if (count >= events->capacity) {
+                events->dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            events->events[count] = event;
+            events->count.store(count + 1, std::memory_order_release);
+        }
+    }
+
+    void Trace::Start(size_t threadCapacity)
+    {
+        threadCapacity = std::max<size_t>(threadCapacity, 1);
+        {
+            // storage of every registered thread is ready before the session is published
+            std::lock_guard lock{g_mutex};
+            const auto session = g_session.load(std::memory_order_relaxed) + 1;
+            for (auto& buffer : g_buffers) {
+                Prepare(*buffer, session, threadCapacity);
+            }
+            g_capacity.store(threadCapacity, std::memory_order_relaxed);
+            g_unready.store(0, std::memory_order_relaxed);
+            g_originNs.store(Now(), std::memory_order_relaxed);
+            g_session.store(session, std::memory_order_release);
+        }
+        _enabled.store(true, std::memory_order_release);
+        Log::Info("trace: started ({} events per thread)", threadCapacity);
+    }
+
+    void Trace::Stop()
+    {
+        _enabled.store(false, std::memory_order_release);
+        Log::Info("trace: stopped");
+    }
+
+    void Trace::SetThreadName(std::string name)
+    {
+        std::lock_guard lock{g_mutex};
+        if (!t_buffer) {
+            auto& buffer = g_buffers.emplace_back(std::make_unique<ThreadBuffer>());
+            buffer->index = static_cast<uint32_t>(g_buffers.size());
+            t_buffer = buffer.get();
+            if (IsEnabled()) {
+                // registered during a session: record from now on
+                Prepare(*buffer, g_session.load(std::memory_order_relaxed), g_capacity.load(std::memory_order_relaxed));
+            }
+        }
+        t_buffer->name = std::move(name);
+    }
+
+    int64_t Trace::Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void Trace::Complete(const char* name, int64_t beginNs, int64_t endNs, const AllocTracker::Counters& allocs)
+    {
+        Record({
+            .name = name,
+            .timeNs = beginNs,
+            .durationNs = endNs - beginNs,
+            .value = 0.0,
+            .id = 0,
+            .allocations = allocs.allocations,
+            .allocatedBytes = allocs.bytes,
+            .type = EventType::Complete,
+        });
+    }
+
+    void Trace::Counter(const char* name, double value)
+    {
+        Record({.name = name, .timeNs = Now(), .durationNs = 0, .value = value, .id = 0, .allocations = 0, .allocatedBytes = 0, .type = EventType::Counter});
+    }
+
+    void Trace::FlowBegin(const char* name, uint64_t id)
+    {
+        Record({.name = name, .timeNs = Now(), .durationNs = 0, .value = 0.0, .id = id, .allocations = 0, .allocatedBytes = 0, .type = EventType::FlowBegin});
+    }
+
+    void Trace::FlowEnd(const char* name, uint64_t id)
+    {
+        Record({.name = name, .timeNs = Now(), .durationNs = 0, .value = 0.0, .id = id, .allocations = 0, .allocatedBytes = 0, .type = EventType::FlowEnd});
+    }
+
+    bool Trace::WriteJson(const std::string& path)
+    {
+        std::ofstream out{path};
+        if (!out) {
+            Log::Error("trace: failed to open '{}'", path);
+            return false;
+        }
+
+        std::lock_guard lock{g_mutex};
+        const auto session = g_session.load(std::memory_order_acquire);
+        const auto originNs = g_originNs.load(std::memory_order_relaxed);
+        const auto micros = [originNs](int64_t ns) { return static_cast<double>(ns - originNs) / 1000.0; };
+
+        size_t written = 0;
+        uint64_t dropped = g_unready.load(std::memory_order_relaxed);
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+        out << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"tx\"}}";
+        for (const auto& buffer : g_buffers) {
+            out << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << buffer->index << ", \"args\": {\"name\": ";
+            Json::WriteString(out, buffer->name);
+            out << "}}";
+
+            const auto* events = buffer->current.load(std::memory_order_acquire);
+            if (!events || events->session != session) {
+                continue;
+            }
+            const auto count = events->count.load(std::memory_order_acquire);
+            dropped += events->dropped.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < count; ++i) {
+                const auto& event = events->events[i];
+                out << ",\n{\"name\": ";
+                Json::WriteString(out, event.name ? event.name : "?");
+                out << ", \"pid\": 1, \"tid\": " << buffer->index << ", \"ts\": " << micros(event.timeNs);
+                switch (event.type) {
+                    case EventType::Complete:
+                        out << ", \"ph\": \"X\", \"dur\": " << static_cast<double>(event.durationNs) / 1000.0;
+                        if (event.allocations) {
+                            out << ", \"args\": {\"allocations\": " << event.allocations << ", \"bytes\": " << event.allocatedBytes << "}";
+                        }
+                        break;
+                    case EventType::Counter:
+                        out << ", \"ph\": \"C\", \"args\": {\"value\": " << event.value << "}";
+                        break;
+                    case EventType::FlowBegin:
+                        out << ", \"ph\": \"s\", \"cat\": \"flow\", \"id\": " << event.id;
+                        break;
+                    case EventType::FlowEnd:
+                        out << ", \"ph\": \"f\", \"bp\": \"e\", \"cat\": \"flow\", \"id\": " << event.id;
+                        break;
+                }
+                out << "}";
+            }
+            written += count;
+        }
+        out << "\n]}\n";
+
+        if (!out) {
+            Log::Error("trace: failed to write '{}'", path);
+            return false;
+        }
+        Log::Info("trace: {} events ({} dropped) written to '{}'", written, dropped, path);
+        return true;
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include "Sdl/Stats/AllocTracker.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Sdl::Stats
+{
+    /// Scoped tracing exported in Chrome trace event format (chrome://tracing, ui.perfetto.dev).
+    /// Every thread registered by SetThreadName records into its own buffer, allocated by Start or the registration
+    /// (no locks or allocations on the hot path, events past the capacity or of unregistered threads are dropped
+    /// and counted). While a session isn't started the macros below cost one relaxed atomic load,
+    /// with TX_TRACE_DISABLE defined they compile to nothing.
+    /// Names must outlive the session (string literals): only the pointers are recorded.
+    /// With the allocation hooks linked, scopes also record the heap allocations made inside them (see AllocTracker).
+    class Trace
+    {
+    public:
+        static constexpr size_t DefaultThreadCapacity = size_t{1} << 18; // events per thread and session
+
+        [[nodiscard]] static bool IsEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+        /// Start a new session (previous events are discarded)
+        static void Start(size_t threadCapacity = DefaultThreadCapacity);
+        static void Stop();
+        /// Write the events of the last session as JSON (call while the traced threads don't start a new one)
+        static bool WriteJson(const std::string& path);
+
+        /// Register the calling thread under the name shown in the trace, only registered threads are recorded
+        static void SetThreadName(std::string name);
+
+        [[nodiscard]] static int64_t Now();
+        static void Complete(const char* name, int64_t beginNs, int64_t endNs, const AllocTracker::Counters& allocs = {});
+        static void Counter(const char* name, double value);
+        /// Arrow from the enclosing scope of FlowBegin to the enclosing scope of FlowEnd w/ the same id
+        static void FlowBegin(const char* name, uint64_t id);
+        static void FlowEnd(const char* name, uint64_t id);
+
+        class Scope
+        {
+        public:
+            explicit Scope(const char* name)
+                : _name(IsEnabled() ? name : nullptr)
+                , _begin(_name ? Now() : 0)
+                , _allocs(_name ? AllocTracker::GetThreadCounters() : AllocTracker::Counters{}) // no TLS access while disabled
+            {}
+
+            ~Scope()
+            {
+                if (_name) {
+                    Complete(_name, _begin, Now(), AllocTracker::GetThreadCounters().Since(_allocs));
+                }
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            const char* _name;
+            int64_t _begin;
+            AllocTracker::Counters _allocs;
+        };
+
+    private:
+        static inline std::atomic<bool> _enabled{false};
+    };
+}
+
+#define TX_TRACE_CONCAT_IMPL(a, b) a##b
+#define TX_TRACE_CONCAT(a, b) TX_TRACE_CONCAT_IMPL(a, b)
+
+#if defined(TX_TRACE_DISABLE)
+#define TX_TRACE_SCOPE(name) ((void)0)
+#define TX_TRACE_COUNTER(name, value) ((void)0)
+#define TX_TRACE_FLOW_BEGIN(name, id) ((void)0)
+#define TX_TRACE_FLOW_END(name, id) ((void)0)
+#else
+#define TX_TRACE_SCOPE(name) ::Sdl::Stats::Trace::Scope TX_TRACE_CONCAT(txTraceScope, __LINE__){name}
+#define TX_TRACE_COUNTER(name, value) \
+    do { \
+        if (::Sdl::Stats::Trace::IsEnabled()) { \
+            ::Sdl::Stats::Trace::Counter(name, static_cast<double>(value)); \
+        } \
+    } while (false)
+#define TX_TRACE_FLOW_BEGIN(name, id) \
+    do { \
+        if (::Sdl::Stats::Trace::IsEnabled()) { \
+            ::Sdl::Stats::Trace::FlowBegin(name, static_cast<uint64_t>(id)); \
+        } \
+    } while (false)
+#define TX_TRACE_FLOW_END(name, id) \
+    do { \
+        if (::Sdl::Stats::Trace::IsEnabled()) { \
+            ::Sdl::Stats::Trace::FlowEnd(name, static_cast<uint64_t>(id)); \
+        } \
+    } while (false)
+#endif
@@ -0,0 +1,226 @@
+#include "TextureLoader.h"
+#include "Log/Log.h"
+#include "Sdl/Stats/Trace.h"
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_iostream.h>
+#include <algorithm>
+
+namespace Sdl
+{
+    namespace
+    {
+        constexpr int PlaceholderSize = 8;
+        constexpr Uint32 PlaceholderDark = 0xFF400040; // ABGR: magenta checker, visible on any background
+        constexpr Uint32 PlaceholderLight = 0xFFFF00FF;
+#if __EMSCRIPTEN__ && !defined(__EMSCRIPTEN_PTHREADS__)
+        constexpr bool HasThreads = false; // std::thread can't start w/o pthreads: decode in Load
+#else
+        constexpr bool HasThreads = true;
+#endif
+    }
+
+    TextureLoader::TextureLoader(SDL_Renderer* renderer, std::shared_ptr<Fs::Drive> drive)
+        : TextureLoader(renderer, std::move(drive), Config{})
+    {}
+
+    TextureLoader::TextureLoader(SDL_Renderer* renderer, std::shared_ptr<Fs::Drive> drive, Config config)
+        : _renderer(renderer)
+        , _drive(std::move(drive))
+        , _config(config)
+        , _format(PreferredFormat(renderer))
+    {
+        CreatePlaceholder();
+        const auto workerCount = HasThreads ? std::max<size_t>(_config.WorkerCount, 1) : 0;
+        _workers.reserve(workerCount);
+        for (size_t index = 0; index < workerCount; ++index) {
+            _workers.emplace_back([this] { RunWorker(); });
+        }
+        Log::Debug("{} workers, format {}", workerCount, SDL_GetPixelFormatName(_format));
+    }
+
+    TextureLoader::~TextureLoader()
+    {
+        {
+            std::lock_guard lock{_mutex};
+            _stopping = true;
+            _requests.clear();
+        }
+        _wakeup.notify_all();
+        for (auto& worker : _workers) {
+            worker.join();
+        }
+        // handles may outlive the loader, their textures may not outlive the renderer
+        for (auto& [path, weak] : _assets) {
+            if (auto asset = weak.lock()) {
+                asset->state.store(State::Failed, std::memory_order_release);
+                asset->texture.reset();
+            }
+        }
+        Log::Debug("uploaded {} ({} bytes), failed {}, shared {}", _stats.uploaded, _stats.uploadedBytes, _stats.failed, _stats.shared);
+    }
+
+    SDL_PixelFormat TextureLoader::PreferredFormat(SDL_Renderer* renderer)
+    {
+        // the renderer's formats list starts with its native (fastest to upload) one
+        const auto* formats = static_cast<const SDL_PixelFormat*>(
+            SDL_GetPointerProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER, nullptr));
+        return formats && formats[0] != SDL_PIXELFORMAT_UNKNOWN ? formats[0] : SDL_PIXELFORMAT_RGBA32;
+    }
+
+    void TextureLoader::CreatePlaceholder()
+    {
+        Uint32 pixels[PlaceholderSize * PlaceholderSize];
+        for (int y = 0; y < PlaceholderSize; ++y) {
+            for (int x = 0; x < PlaceholderSize; ++x) {
+                pixels[y * PlaceholderSize + x] = ((x / 2 + y / 2) % 2) != 0 ? PlaceholderLight : PlaceholderDark;
+            }
+        }
+        _placeholder.reset(SDL_CreateTexture(_renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, PlaceholderSize, PlaceholderSize));
+        if (!_placeholder || !SDL_UpdateTexture(_placeholder.get(), nullptr, pixels, PlaceholderSize * static_cast<int>(sizeof(Uint32)))) {
+            Log::Warn("placeholder texture failed: {}", SDL_GetError());
+            return;
+        }
+        SDL_SetTextureScaleMode(_placeholder.get(), SDL_SCALEMODE_NEAREST);
+    }
+
+    TextureLoader::Handle TextureLoader::Load(const Fs::Path& path)
+    {
+        TX_TRACE_SCOPE("TextureLoader::Load");
+        ++_stats.requested;
+        auto key = path.string();
+        if (auto found = _assets.find(key); found != _assets.end()) {
+            if (auto asset = found->second.lock()) {
+                ++_stats.shared;
+                return {std::move(asset), _placeholder.get()};
+            }
+        }
+
+        // drop the paths of released assets once the map doubled since the last pass (amortized O(1) per load)
+        if (_assets.size() >= _pruneSize) {
+            std::erase_if(_assets, [](const auto& entry) { return entry.second.expired(); });
+            _pruneSize = std::max(MinPruneSize, _assets.size() * 2);
+        }
+
+        auto asset = std::make_shared<Asset>();
+        asset->path = key;
+        _assets.insert_or_assign(std::move(key), asset);
+        TX_TRACE_FLOW_BEGIN("TextureLoad", reinterpret_cast<uintptr_t>(asset.get()));
+        if (_workers.empty()) {
+            Decode(*asset);
+            std::lock_guard lock{_mutex};
+            _decoded.push_back(asset);
+            return {std::move(asset), _placeholder.get()};
+        }
+        {
+            std::lock_guard lock{_mutex};
+            _requests.push_back(asset);
+        }
+        _wakeup.notify_one();
+        return {std::move(asset), _placeholder.get()};
+    }
+
+    void TextureLoader::RunWorker()
+    {
+        Sdl::Stats::Trace::SetThreadName("TextureLoader");
+        std::unique_lock lock{_mutex};
+        while (true) {
+            _wakeup.wait(lock, [this] { return _stopping || !_requests.empty(); });
+            if (_stopping) {
+                return;
+            }
+            auto asset = std::move(_requests.front());
+            _requests.pop_front();
+            if (asset.use_count() == 1) {
+                continue; // all handles are gone
+            }
+
+            lock.unlock();
+            Decode(*asset);
+            lock.lock();
+            _decoded.push_back(std::move(asset));
+        }
+    }
+
+    void TextureLoader::Decode(Asset& asset) const
+    {
+        TX_TRACE_SCOPE("TextureLoader::Decode");
+        const Fs::Path path{asset.path};
+        auto sizeResult = _drive->GetSize(path);
+        if (!sizeResult) {
+            Log::Warn("GetSize failed: {} ({})", asset.path, sizeResult.error().message());
+            return;
+        }
+        std::vector<uint8_t> data(*sizeResult);
+        auto readResult = _drive->ReadAllTo(path, data);
+        if (!readResult) {
+            Log::Warn("ReadAllTo failed: {} ({})", asset.path, readResult.error().message());
+            return;
+        }
+
+        Surface decoded{SDL_LoadBMP_IO(SDL_IOFromConstMem(data.data(), *readResult), true)};
+        if (!decoded) {
+            Log::Warn("decode failed: {} ({})", asset.path, SDL_GetError());
+            return;
+        }
+        if (decoded->format != _format) {
+            decoded.reset(SDL_ConvertSurface(decoded.get(), _format));
+            if (!decoded) {
+                Log::Warn("convert failed: {} ({})", asset.path, SDL_GetError());
+                return;
+            }
+        }
+        asset.surface = std::move(decoded);
+    }
+
+    void TextureLoader::Update()
+    {
+        std::vector<std::shared_ptr<Asset>> decoded;
+        {
+            std::lock_guard lock{_mutex};
+            if (_decoded.empty()) {
+                return;
+            }
+            decoded.swap(_decoded);
+        }
+
+        size_t spent = 0;
+        size_t index = 0;
+        for (; index < decoded.size() && (index == 0 || spent < _config.UploadBudgetBytes); ++index) {
+            auto& asset = *decoded[index];
+            if (asset.surface) {
+                spent += static_cast<size_t>(asset.surface->pitch) * static_cast<size_t>(asset.surface->h);
+            }
+            Upload(asset);
+        }
+
+        // over budget: keep the rest (in order) for the next frames
+        _stats.pendingUploads = decoded.size() - index;
+        if (index < decoded.size()) {
+            std::lock_guard lock{_mutex};
+            _decoded.insert(_decoded.begin(), std::make_move_iterator(decoded.begin() + static_cast<std::ptrdiff_t>(index)), std::make_move_iterator(decoded.end()));
+        }
+    }
+
+    void TextureLoader::Upload(Asset& asset)
+    {
+        TX_TRACE_SCOPE("TextureLoader::Upload");
+        TX_TRACE_FLOW_END("TextureLoad", reinterpret_cast<uintptr_t>(&asset));
+        auto surface = std::move(asset.surface);
+        if (surface) {
+            asset.texture.reset(SDL_CreateTextureFromSurface(_renderer, surface.get()));
+            if (!asset.texture) {
+                Log::Warn("texture failed: {} ({})", asset.path, SDL_GetError());
+            }
+        }
+        if (!asset.texture) {
+            ++_stats.failed;
+            asset.state.store(State::Failed, std::memory_order_release);
+            return;
+        }
+        asset.width = surface->w;
+        asset.height = surface->h;
+        ++_stats.uploaded;
+        _stats.uploadedBytes += static_cast<uint64_t>(surface->pitch) * static_cast<uint64_t>(surface->h);
+        asset.state.store(State::Ready, std::memory_order_release);
+    }
+}
@@ -0,0 +1,132 @@
+#pragma once
+#include "Fs/Drive.h"
+#include "Sdl/Sdl3Ptr.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Sdl
+{
+    /// Asynchronous texture loading: files are read via Fs::Drive and decoded (BMP) on worker threads,
+    /// converted there to the renderer's preferred pixel format, and turned into textures on the main thread
+    /// in Update() within a per-frame byte budget, so loads don't stall the frame loop.
+    /// Handles draw a placeholder texture until their asset is ready (or failed).
+    /// Loads of the same path share one asset while any handle to it is alive.
+    /// W/o thread support (Emscripten w/o pthreads) files are decoded in Load, textures are still created in Update.
+    class TextureLoader
+    {
+    public:
+        struct Config
+        {
+            size_t WorkerCount = 2;
+            size_t UploadBudgetBytes = size_t{8} << 20; // texture bytes created per Update (at least one texture)
+        };
+
+        enum class State : uint8_t
+        {
+            Pending,
+            Ready,
+            Failed,
+        };
+
+        struct Stats
+        {
+            uint64_t requested = 0;
+            uint64_t shared = 0; // requests served by an already loading/loaded asset
+            uint64_t uploaded = 0;
+            uint64_t failed = 0;
+            uint64_t uploadedBytes = 0;
+            size_t pendingUploads = 0; // decoded, waiting for the budget
+        };
+
+    private:
+        struct Asset
+        {
+            std::string path;
+            std::atomic<State> state{State::Pending};
+            Texture texture; // main thread only
+            Surface surface; // decoded, handed from a worker to the main thread
+            int width{};
+            int height{};
+        };
+
+    public:
+        /// Shared reference to a loading asset
+        class Handle
+        {
+        public:
+            Handle() = default;
+
+            [[nodiscard]] State GetState() const { return _asset ? _asset->state.load(std::memory_order_acquire) : State::Failed; }
+            [[nodiscard]] bool IsReady() const { return GetState() == State::Ready; }
+            [[nodiscard]] bool IsDone() const { return GetState() != State::Pending; }
+
+            /// Loaded texture, the placeholder while pending or failed
+            [[nodiscard]] SDL_Texture* Get() const { return IsReady() ? _asset->texture.get() : _placeholder; }
+            /// Size of the loaded texture (0 until ready)
+            [[nodiscard]] int GetWidth() const { return IsReady() ? _asset->width : 0; }
+            [[nodiscard]] int GetHeight() const { return IsReady() ? _asset->height : 0; }
+
+        private:
+            friend class TextureLoader;
+
+            Handle(std::shared_ptr<Asset> asset, SDL_Texture* placeholder)
+                : _asset(std::move(asset))
+                , _placeholder(placeholder)
+            {}
+
+            std::shared_ptr<Asset> _asset;
+            SDL_Texture* _placeholder{};
+        };
+
+        TextureLoader(SDL_Renderer* renderer, std::shared_ptr<Fs::Drive> drive);
+        TextureLoader(SDL_Renderer* renderer, std::shared_ptr<Fs::Drive> drive, Config config);
+        /// Stops the workers (queued loads are dropped); textures of the handles are destroyed with the loader
+        ~TextureLoader();
+
+        TextureLoader(const TextureLoader&) = delete;
+        TextureLoader& operator=(const TextureLoader&) = delete;
+
+        /// Queue the file load (main thread)
+        Handle Load(const Fs::Path& path);
+
+        /// Create textures of decoded assets within the budget (main thread, once per frame)
+        void Update();
+
+        [[nodiscard]] SDL_Texture* GetPlaceholder() const { return _placeholder.get(); }
+        [[nodiscard]] SDL_PixelFormat GetFormat() const { return _format; }
+        [[nodiscard]] const Stats& GetStats() const { return _stats; }
+
+    private:
+        SDL_Renderer* _renderer;
+        std::shared_ptr<Fs::Drive> _drive;
+        Config _config;
+        SDL_PixelFormat _format;
+        Texture _placeholder;
+        Stats _stats;
+
+        std::unordered_map<std::string, std::weak_ptr<Asset>> _assets;
+        static constexpr size_t MinPruneSize = 64;
+        size_t _pruneSize = MinPruneSize; // _assets size of the next pass over the expired entries
+
+        std::mutex _mutex;
+        std::condition_variable _wakeup;
+        std::deque<std::shared_ptr<Asset>> _requests;
+        std::vector<std::shared_ptr<Asset>> _decoded;
+        bool _stopping = false;
+        std::vector<std::thread> _workers;
+
+        void RunWorker();
+        void Decode(Asset& asset) const;
+        void Upload(Asset& asset);
+        void CreatePlaceholder();
+        static SDL_PixelFormat PreferredFormat(SDL_Renderer* renderer);
+    };
+}
@@ -0,0 +1,156 @@
+#include "TexturePool.h"
+#include "Log/Log.h"
+#include <SDL3/SDL_error.h>
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace Sdl
+{
+    TexturePool::Lease::Lease(Lease&& other) noexcept
+        : _pool(std::exchange(other._pool, nullptr))
+        , _texture(std::move(other._texture))
+        , _key(other._key)
+        , _width(other._width)
+        , _height(other._height)
+    {}
+
+    TexturePool::Lease& TexturePool::Lease::operator=(Lease&& other) noexcept
+    {
+        if (this != &other) {
+            Release();
+            _pool = std::exchange(other._pool, nullptr);
+            _texture = std::move(other._texture);
+            _key = other._key;
+            _width = other._width;
+            _height = other._height;
+        }
+        return *this;
+    }
+
+    void TexturePool::Lease::Release()
+    {
+        if (_pool && _texture) {
+            _pool->Return(std::move(_texture), _key);
+        }
+        _pool = nullptr;
+        _texture.reset();
+    }
+
+    TexturePool::TexturePool(SDL_Renderer* renderer)
+        : TexturePool(renderer, Config{})
+    {}
+
+    TexturePool::TexturePool(SDL_Renderer* renderer, Config config)
+        : _renderer(renderer)
+        , _config(config)
+    {}
+
+    TexturePool::~TexturePool()
+    {
+        if (_stats.leasedCount > 0) {
+            Log::Warn("destroyed with {} textures leased", _stats.leasedCount);
+        }
+        Log::Debug("hits {} misses {} evicted {}", _stats.hits, _stats.misses, _stats.evicted);
+        Clear();
+    }
+
+    int TexturePool::SizeClass(int size)
+    {
+        return static_cast<int>(std::bit_ceil(static_cast<unsigned>(std::max(size, MinSize))));
+    }
+
+    size_t TexturePool::EstimateBytes(SDL_PixelFormat format, int w, int h)
+    {
+        const auto bytesPerPixel = std::max<size_t>(SDL_BYTESPERPIXEL(format), 1);
+        return static_cast<size_t>(w) * static_cast<size_t>(h) * bytesPerPixel;
+    }
+
+    TexturePool::Lease TexturePool::Acquire(SDL_PixelFormat format, SDL_TextureAccess access, int w, int h)
+    {
+        const Key key{format, access, SizeClass(w), SizeClass(h)};
+        const auto bytes = EstimateBytes(format, key.w, key.h);
+
+        Lease lease;
+        // the most recently released match: likely still resident
+        for (auto index = _released.size(); index-- > 0;) {
+            if (_released[index].key == key) {
+                lease._texture = std::move(_released[index].texture);
+                _released.erase(_released.begin() + static_cast<std::ptrdiff_t>(index));
+                _stats.pooledCount -= 1;
+                _stats.pooledBytes -= bytes;
+                ++_stats.hits;
+                break;
+            }
+        }
+        if (!lease._texture) {
+            lease._texture.reset(SDL_CreateTexture(_renderer, format, access, key.w, key.h));
+            if (!lease._texture) {
+                Log::Error("SDL_CreateTexture {}x{} failed: {}", key.w, key.h, SDL_GetError());
+                return {};
+            }
+            ++_stats.misses;
+        }
+
+        auto* texture = lease._texture.get();
+        SDL_SetTextureBlendMode(texture, SDL_ISPIXELFORMAT_ALPHA(format) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+        SDL_SetTextureColorMod(texture, 255, 255, 255);
+        SDL_SetTextureAlphaMod(texture, 255);
+        SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_LINEAR);
+
+        lease._pool = this;
+        lease._key = key;
+        lease._width = w;
+        lease._height = h;
+        _stats.leasedCount += 1;
+        _stats.leasedBytes += bytes;
+        return lease;
+    }
+
+    void TexturePool::Return(Texture texture, const Key& key)
+    {
+        const auto bytes = EstimateBytes(key.format, key.w, key.h);
+        _stats.leasedCount -= 1;
+        _stats.leasedBytes -= bytes;
+
+        _released.push_back({key, std::move(texture), _frame, bytes});
+        _stats.pooledCount += 1;
+        _stats.pooledBytes += bytes;
+        EvictOverBudget();
+    }
+
+    void TexturePool::EndFrame()
+    {
+        ++_frame;
+        // release order is frame order: idle ones are at the front
+        size_t count = 0;
+        while (count < _released.size() && _frame - _released[count].releasedFrame > _config.MaxIdleFrames) {
+            ++count;
+        }
+        for (; count > 0; --count) {
+            Evict(0);
+        }
+    }
+
+    void TexturePool::Clear()
+    {
+        while (!_released.empty()) {
+            Evict(_released.size() - 1);
+        }
+    }
+
+    void TexturePool::EvictOverBudget()
+    {
+        while (_stats.pooledBytes > _config.MemoryBudget && !_released.empty()) {
+            Evict(0);
+        }
+    }
+
+    void TexturePool::Evict(size_t index)
+    {
+        _stats.pooledCount -= 1;
+        _stats.pooledBytes -= _released[index].bytes;
+        ++_stats.evicted;
+        _released.erase(_released.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include "Sdl/Sdl3Ptr.h"
+#include <cstdint>
+#include <vector>
+
+namespace Sdl
+{
+    /// Recycles textures by (format, access, size class) instead of destroying them, for temporary
+    /// render targets and streaming textures created per frame or per resize.
+    /// Sizes are rounded up to a power of two (at least MinSize), so a lease may be larger than requested:
+    /// use GetRect() as the source rect / viewport of the requested area.
+    /// Released textures are destroyed when idle longer than MaxIdleFrames (see EndFrame) or, oldest first,
+    /// when the pooled ones exceed the memory budget. The pool must outlive its leases and the renderer the pool.
+    class TexturePool
+    {
+        struct Key
+        {
+            SDL_PixelFormat format;
+            SDL_TextureAccess access;
+            int w; // size class
+            int h;
+
+            bool operator==(const Key&) const = default;
+        };
+
+    public:
+        static constexpr int MinSize = 64;
+
+        struct Config
+        {
+            size_t MemoryBudget = size_t{128} << 20; // bytes of released textures kept for reuse
+            uint64_t MaxIdleFrames = 300;
+        };
+
+        struct Stats
+        {
+            uint64_t hits = 0;
+            uint64_t misses = 0; // textures created
+            uint64_t evicted = 0; // textures destroyed by idle time or budget
+            size_t pooledCount = 0;
+            size_t pooledBytes = 0;
+            size_t leasedCount = 0;
+            size_t leasedBytes = 0;
+        };
+
+        /// Move-only texture loan: gives the texture back to the pool on destruction
+        class Lease
+        {
+        public:
+            Lease() = default;
+            Lease(Lease&& other) noexcept;
+            Lease& operator=(Lease&& other) noexcept;
+            ~Lease() { Release(); }
+
+            Lease(const Lease&) = delete;
+            Lease& operator=(const Lease&) = delete;
+
+            [[nodiscard]] SDL_Texture* Get() const { return _texture.get(); }
+            explicit operator bool() const { return static_cast<bool>(_texture); }
+
+            /// Requested area within the (possibly larger) texture
+            [[nodiscard]] SDL_Rect GetRect() const { return {0, 0, _width, _height}; }
+            [[nodiscard]] SDL_FRect GetFRect() const { return {0, 0, static_cast<float>(_width), static_cast<float>(_height)}; }
+
+            /// Give back early
+            void Release();
+
+        private:
+            friend class TexturePool;
+
+            TexturePool* _pool{};
+            Texture _texture;
+            Key _key{};
+            int _width{};
+            int _height{};
+        };
+
+        explicit TexturePool(SDL_Renderer* renderer);
+        TexturePool(SDL_Renderer* renderer, Config config);
+        ~TexturePool();
+
+        TexturePool(const TexturePool&) = delete;
+        TexturePool& operator=(const TexturePool&) = delete;
+
+        /// Pooled or new texture of at least w x h; blend mode, color/alpha mod and scale mode are reset to defaults.
+        /// Empty lease when SDL fails to create one.
+        Lease Acquire(SDL_PixelFormat format, SDL_TextureAccess access, int w, int h);
+
+        /// Frame boundary: destroys textures idle for too long
+        void EndFrame();
+        /// Destroy all released textures
+        void Clear();
+
+        [[nodiscard]] const Stats& GetStats() const { return _stats; }
+
+        [[nodiscard]] static int SizeClass(int size);
+        [[nodiscard]] static size_t EstimateBytes(SDL_PixelFormat format, int w, int h);
+
+    private:
+        struct Entry
+        {
+            Key key;
+            Texture texture;
+            uint64_t releasedFrame;
+            size_t bytes;
+        };
+
+        SDL_Renderer* _renderer;
+        Config _config;
+        std::vector<Entry> _released; // in release order: the front is the oldest
+        uint64_t _frame = 0;
+        Stats _stats;
+
+        void Return(Texture texture, const Key& key);
+        void EvictOverBudget();
+        void Evict(size_t index);
+    };
+}
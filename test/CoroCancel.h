@@ -0,0 +1,165 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+class CancellationRegistration;
+
+namespace CoroDetail
+{
+    struct CancellationState {
+        std::atomic<bool> requested{false};
+        std::mutex mutex; // guards the list and the running callback below
+        CancellationRegistration* callbacks = nullptr; // intrusive list, no allocations
+        CancellationRegistration* running = nullptr; // callback being invoked by request_cancel
+        std::thread::id runningThread;
+    };
+}
+
+/// Non-owning view of a CancellationSource (the source must outlive its tokens).
+/// A default token can never be cancelled.
+class CancellationToken {
+public:
+    CancellationToken() noexcept = default;
+
+    [[nodiscard]] bool can_be_cancelled() const noexcept { return state != nullptr; }
+    [[nodiscard]] bool is_cancellation_requested() const noexcept {
+        return state && state->requested.load(std::memory_order_acquire);
+    }
+
+private:
+    friend class CancellationSource;
+    friend class CancellationRegistration;
+
+    explicit CancellationToken(CoroDetail::CancellationState* state) noexcept
+        : state(state) {}
+
+    CoroDetail::CancellationState* state = nullptr;
+};
+
+/// Callback linked into a token's source while registered, unlinked on reset/destruction.
+/// Copies/moves start unregistered: an awaiter registers once it's placed in the coroutine frame.
+/// Like std::stop_callback, reset waits for the callback when it's being invoked on another thread,
+/// so the context of the callback stays alive until it returns.
+class CancellationRegistration {
+public:
+    using Callback = void (*)(void* context);
+
+    CancellationRegistration() noexcept = default;
+    CancellationRegistration(const CancellationRegistration&) noexcept {}
+    CancellationRegistration& operator=(const CancellationRegistration&) = delete;
+    ~CancellationRegistration() { reset(); }
+
+    /// Returns false (and doesn't register) when cancellation was already requested.
+    bool register_callback(CancellationToken token, Callback callback, void* context) noexcept {
+        return register_callback(token, callback, context, [] {});
+    }
+
+    /// Same, and starts the cancellable operation with `start()` before the callback can be invoked
+    /// (it isn't started when cancellation was already requested). `start` may hand the callback's context
+    /// over to another thread: the registration isn't touched after it.
+    template<typename Start>
+    bool register_callback(CancellationToken token, Callback callback, void* context, Start&& start) {
+        reset();
+        if (!token.state) {
+            start();
+            return true;
+        }
+        std::lock_guard lock{token.state->mutex};
+        if (token.state->requested.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        state = token.state;
+        this->callback = callback;
+        this->context = context;
+        next = state->callbacks;
+        if (next) {
+            next->prev = this;
+        }
+        state->callbacks = this;
+        start(); // request_cancel takes the lock to pick the callback, so it waits for the start
+        return true;
+    }
+
+    void reset() noexcept {
+        auto* current = state;
+        if (!current) {
+            return;
+        }
+        std::unique_lock lock{current->mutex};
+        state = nullptr;
+        if (prev || current->callbacks == this) {
+            unlink(*current);
+            return;
+        }
+        // picked by request_cancel: wait until its callback returned unless it's running on this thread
+        if (current->runningThread != std::this_thread::get_id()) {
+            while (current->running == this) {
+                lock.unlock();
+                std::this_thread::yield();
+                lock.lock();
+            }
+        }
+    }
+
+private:
+    friend class CancellationSource;
+
+    CoroDetail::CancellationState* state = nullptr;
+    CancellationRegistration* prev = nullptr;
+    CancellationRegistration* next = nullptr;
+    Callback callback = nullptr;
+    void* context = nullptr;
+
+    void unlink(CoroDetail::CancellationState& current) noexcept {
+        if (prev) {
+            prev->next = next;
+        } else {
+            current.callbacks = next;
+        }
+        if (next) {
+            next->prev = prev;
+        }
+        prev = next = nullptr;
+    }
+};
+
+/// Cooperative cancellation owner. Thread-safe: request_cancel runs the registered callbacks in place
+/// on the calling thread (outside of the lock, so they may reset/destroy their registrations).
+/// Whether the cancelled operation itself may be touched from that thread is up to it
+/// (e.g. timers of StealingSynCtx may, those of QueueSynCtx belong to its consumer thread).
+class CancellationSource {
+public:
+    CancellationSource() noexcept = default;
+    CancellationSource(const CancellationSource&) = delete;
+    CancellationSource& operator=(const CancellationSource&) = delete;
+
+    [[nodiscard]] CancellationToken token() noexcept { return CancellationToken{&state}; }
+    [[nodiscard]] bool is_cancellation_requested() const noexcept { return state.requested.load(std::memory_order_acquire); }
+
+    /// Returns false if it was already requested
+    bool request_cancel() noexcept {
+        std::unique_lock lock{state.mutex};
+        if (state.requested.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        state.requested.store(true, std::memory_order_release);
+        state.runningThread = std::this_thread::get_id();
+        // each callback is unlinked before it runs, its registration isn't touched after it
+        while (auto* registration = state.callbacks) {
+            registration->unlink(state);
+            auto callback = registration->callback;
+            auto* context = registration->context;
+            state.running = registration;
+            lock.unlock();
+            callback(context);
+            lock.lock();
+            state.running = nullptr;
+        }
+        return true;
+    }
+
+private:
+    CoroDetail::CancellationState state;
+};
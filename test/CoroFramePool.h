@@ -0,0 +1,101 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <new>
+
+/// Size-class cache for coroutine frames.
+/// Frames are rounded up to a size class and recycled through per-thread free lists, so steady-state
+/// create/destroy cycles don't reach the system allocator. Blocks are individually allocated, which lets
+/// a frame be freed on another thread than it was created on (it just joins that thread's cache).
+class FramePool {
+public:
+    static constexpr size_t Granularity = 64;
+    static constexpr size_t ClassCount = 16; // classes up to 1 KiB, larger frames bypass the pool
+    static constexpr size_t MaxPooledSize = Granularity * ClassCount;
+    static constexpr size_t MaxCachedPerClass = 4096;
+
+    /// Per-thread counters (current thread)
+    struct Stats {
+        size_t allocations = 0; // total frame allocations
+        size_t systemAllocations = 0; // of them served by the system allocator (cache miss or oversized)
+        size_t deallocations = 0;
+        size_t cached = 0; // blocks currently held in free lists
+    };
+
+    static void* allocate(size_t size) {
+        auto& self = local();
+        ++self.counters.allocations;
+        if (size > MaxPooledSize) {
+            ++self.counters.systemAllocations;
+            return ::operator new(size);
+        }
+        const auto index = class_index(size);
+        if (auto* block = self.freeLists[index]) {
+            self.freeLists[index] = block->next;
+            --self.counts[index];
+            --self.counters.cached;
+            return block;
+        }
+        ++self.counters.systemAllocations;
+        return ::operator new(class_size(index));
+    }
+
+    static void deallocate(void* ptr, size_t size) noexcept {
+        auto& self = local();
+        ++self.counters.deallocations;
+        if (size > MaxPooledSize) {
+            ::operator delete(ptr, size);
+            return;
+        }
+        const auto index = class_index(size);
+        if (self.counts[index] >= MaxCachedPerClass) {
+            ::operator delete(ptr, class_size(index));
+            return;
+        }
+        self.freeLists[index] = ::new (ptr) Block{self.freeLists[index]};
+        ++self.counts[index];
+        ++self.counters.cached;
+    }
+
+    [[nodiscard]] static const Stats& stats() noexcept { return local().counters; }
+
+    /// Reset counters (cached blocks are kept)
+    static void reset_stats() noexcept {
+        auto& self = local();
+        self.counters = {.cached = self.counters.cached};
+    }
+
+private:
+    struct Block {
+        Block* next;
+    };
+
+    std::array<Block*, ClassCount> freeLists{};
+    std::array<size_t, ClassCount> counts{};
+    Stats counters;
+
+    FramePool() = default;
+
+    ~FramePool() {
+        for (size_t index = 0; index < ClassCount; ++index) {
+            while (auto* block = freeLists[index]) {
+                freeLists[index] = block->next;
+                ::operator delete(block, class_size(index));
+            }
+        }
+    }
+
+    static FramePool& local() noexcept {
+        thread_local FramePool pool;
+        return pool;
+    }
+
+    static constexpr size_t class_index(size_t size) noexcept { return size == 0 ? 0 : (size - 1) / Granularity; }
+    static constexpr size_t class_size(size_t index) noexcept { return (index + 1) * Granularity; }
+};
+
+/// Base for promise types: routes coroutine frame allocation through FramePool
+struct PooledFrame {
+    static void* operator new(size_t size) { return FramePool::allocate(size); }
+    static void operator delete(void* ptr, size_t size) noexcept { FramePool::deallocate(ptr, size); }
+};
@@ -0,0 +1,388 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace CoroDetail
+{
+    inline constexpr size_t CacheLineSize = 64;
+
+    inline void cpu_relax(unsigned& spins) noexcept {
+        if (++spins > 64) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/// Unbounded lock-free multi-producer/single-consumer queue.
+/// Values live in linked fixed-size segments, so a push only allocates once per segment:
+/// producers claim slots by CAS on the tail index, the consumer reads slots in order and
+/// frees a segment after its last slot was read (no producer can touch it anymore).
+template<typename T, size_t SegmentSize = 256>
+class MpscQueue {
+    static_assert(SegmentSize >= 2);
+
+    struct Slot {
+        std::atomic<bool> ready{false};
+        T value{};
+    };
+
+    struct Segment {
+        std::atomic<Segment*> next{nullptr};
+        std::array<Slot, SegmentSize> slots;
+    };
+
+    // Index layout: `lap` of SegmentSize + 1 positions, the extra one marks "next segment is being installed".
+    static constexpr size_t Lap = SegmentSize + 1;
+
+public:
+    MpscQueue() {
+        auto* segment = new Segment();
+        tail.segment.store(segment, std::memory_order_relaxed);
+        head.segment = segment;
+    }
+
+    ~MpscQueue() {
+        auto* segment = head.segment;
+        while (segment) {
+            auto* next = segment->next.load(std::memory_order_relaxed);
+            delete segment;
+            segment = next;
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /// Never fails (unbounded); safe to call from any thread.
+    bool try_push(T value) {
+        std::unique_ptr<Segment> spare;
+        unsigned spins = 0;
+        for (;;) {
+            auto index = tail.index.load(std::memory_order_acquire);
+            auto* segment = tail.segment.load(std::memory_order_acquire);
+            const auto offset = index % Lap;
+            if (offset == SegmentSize) {
+                // another producer is installing the next segment
+                CoroDetail::cpu_relax(spins);
+                continue;
+            }
+            if (offset + 1 == SegmentSize && !spare) {
+                spare = std::make_unique<Segment>();
+            }
+            if (!tail.index.compare_exchange_weak(index, index + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                CoroDetail::cpu_relax(spins);
+                continue;
+            }
+            if (offset + 1 == SegmentSize) {
+                // claimed the last slot: publish the next segment and skip the marker position
+                auto* next = spare.release();
+                tail.segment.store(next, std::memory_order_release);
+                tail.index.store(index + 2, std::memory_order_release);
+                segment->next.store(next, std::memory_order_release);
+            }
+            auto& slot = segment->slots[offset];
+            slot.value = std::move(value);
+            slot.ready.store(true, std::memory_order_release);
+            return true;
+        }
+    }
+
+    /// Consumer only.
+    bool try_pop(T& out) {
+        const auto offset = head.index % Lap;
+        auto& slot = head.segment->slots[offset];
+        if (!slot.ready.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = std::move(slot.value);
+        if (offset + 1 == SegmentSize) {
+            // last slot read: all producers are done with this segment
+            unsigned spins = 0;
+            Segment* next = nullptr;
+            while (!(next = head.segment->next.load(std::memory_order_acquire))) {
+                CoroDetail::cpu_relax(spins);
+            }
+            delete head.segment;
+            head.segment = next;
+            head.index += 2;
+        } else {
+            ++head.index;
+        }
+        return true;
+    }
+
+    /// Consumer only: pop up to `max` values in one batch, returns how many were handled.
+    template<typename Func>
+    size_t drain(Func&& func, size_t max = SIZE_MAX) {
+        size_t count = 0;
+        T value;
+        while (count < max && try_pop(value)) {
+            ++count;
+            func(std::move(value));
+        }
+        return count;
+    }
+
+    /// Approximate when producers are active; exact from the consumer when they are idle.
+    [[nodiscard]] bool empty() const noexcept {
+        return head.index == tail.index.load(std::memory_order_acquire);
+    }
+
+private:
+    struct alignas(CoroDetail::CacheLineSize) {
+        std::atomic<size_t> index{0};
+        std::atomic<Segment*> segment{nullptr};
+    } tail;
+
+    struct alignas(CoroDetail::CacheLineSize) {
+        size_t index = 0;
+        Segment* segment = nullptr;
+    } head;
+};
+
+/// Bounded lock-free multi-producer/single-consumer ring (Vyukov's sequence-numbered cells).
+/// Allocates once in the constructor; `try_push` fails when the ring is full.
+template<typename T>
+class BoundedMpscQueue {
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value{};
+    };
+
+public:
+    static constexpr size_t DefaultCapacity = 1024;
+
+    explicit BoundedMpscQueue(size_t capacity = DefaultCapacity)
+        : mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1)
+        , cells(std::make_unique<Cell[]>(mask + 1)) {
+        for (size_t i = 0; i <= mask; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+    BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+
+    bool try_push(T value) {
+        auto pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = cells[pos & mask];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // full
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Consumer only.
+    bool try_pop(T& out) {
+        auto& cell = cells[dequeuePos & mask];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence != dequeuePos + 1) {
+            return false;
+        }
+        out = std::move(cell.value);
+        cell.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+        ++dequeuePos;
+        return true;
+    }
+
+    template<typename Func>
+    size_t drain(Func&& func, size_t max = SIZE_MAX) {
+        size_t count = 0;
+        T value;
+        while (count < max && try_pop(value)) {
+            ++count;
+            func(std::move(value));
+        }
+        return count;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return dequeuePos == enqueuePos.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept { return mask + 1; }
+
+private:
+    const size_t mask;
+    std::unique_ptr<Cell[]> cells;
+    alignas(CoroDetail::CacheLineSize) std::atomic<size_t> enqueuePos{0};
+    alignas(CoroDetail::CacheLineSize) size_t dequeuePos = 0;
+};
+
+/// Single-waiter wait/notify token: `unpark` is a single atomic exchange while the waiter is running,
+/// the mutex/condition variable are only touched when it actually sleeps.
+/// A notify that arrives before `park_until` is remembered, so no wakeup is lost.
+class Parker {
+    enum State : int { Empty, Notified, Parked };
+
+public:
+    /// Block until notified or the deadline passes; returns false on timeout.
+    template<typename Clock, typename Duration>
+    bool park_until(std::chrono::time_point<Clock, Duration> deadline) {
+        auto expected = int{Notified};
+        if (state.compare_exchange_strong(expected, Empty, std::memory_order_acquire)) {
+            return true;
+        }
+
+        std::unique_lock lock{mutex};
+        expected = Empty;
+        if (!state.compare_exchange_strong(expected, Parked, std::memory_order_acquire)) {
+            // notified between the checks
+            state.store(Empty, std::memory_order_relaxed);
+            return true;
+        }
+        for (;;) {
+            const auto status = condition.wait_until(lock, deadline);
+            expected = Notified;
+            if (state.compare_exchange_strong(expected, Empty, std::memory_order_acquire)) {
+                return true;
+            }
+            if (status == std::cv_status::timeout) {
+                expected = Parked;
+                if (state.compare_exchange_strong(expected, Empty, std::memory_order_acquire)) {
+                    return false;
+                }
+                state.store(Empty, std::memory_order_relaxed); // raced with unpark
+                return true;
+            }
+        }
+    }
+
+    void park() { park_until(std::chrono::steady_clock::time_point::max()); }
+
+    void unpark() {
+        if (state.exchange(Notified, std::memory_order_release) == Parked) {
+            // waiter may be between the state change and the wait: sync through the mutex
+            { std::lock_guard lock{mutex}; }
+            condition.notify_one();
+        }
+    }
+
+private:
+    std::atomic<int> state{Empty};
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+
+/// Chase-Lev work-stealing deque (Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models").
+/// The owner pushes/pops at the bottom (LIFO, cache-warm), thieves steal from the top (FIFO).
+/// Grows on demand; retired buffers are kept until destruction since a thief may still read them.
+template<typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    struct Buffer {
+        explicit Buffer(size_t capacity)
+            : mask(capacity - 1)
+            , items(std::make_unique<std::atomic<T>[]>(capacity)) {}
+
+        [[nodiscard]] size_t capacity() const noexcept { return mask + 1; }
+        T get(int64_t index) const noexcept { return items[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed); }
+        void put(int64_t index, T value) noexcept { items[static_cast<size_t>(index) & mask].store(value, std::memory_order_relaxed); }
+
+        size_t mask;
+        std::unique_ptr<std::atomic<T>[]> items;
+    };
+
+public:
+    explicit WorkStealingDeque(size_t capacity = 256) {
+        buffers.push_back(std::make_unique<Buffer>(std::bit_ceil(std::max<size_t>(capacity, 2))));
+        buffer.store(buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /// Owner only.
+    void push(T value) {
+        const auto b = bottom.load(std::memory_order_relaxed);
+        const auto t = top.load(std::memory_order_acquire);
+        auto* current = buffer.load(std::memory_order_relaxed);
+        if (b - t >= static_cast<int64_t>(current->capacity())) {
+            current = grow(current, t, b);
+        }
+        current->put(b, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    /// Owner only.
+    bool pop(T& out) {
+        const auto b = bottom.load(std::memory_order_relaxed) - 1;
+        auto* current = buffer.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        out = current->get(b);
+        if (t == b) {
+            // last item: race against thieves
+            const bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /// Any thread.
+    bool steal(T& out) {
+        auto t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        auto* current = buffer.load(std::memory_order_acquire);
+        out = current->get(t);
+        return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    /// Approximate unless called by the owner while no thief is active.
+    [[nodiscard]] size_t size() const noexcept {
+        const auto b = bottom.load(std::memory_order_relaxed);
+        const auto t = top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+private:
+    alignas(CoroDetail::CacheLineSize) std::atomic<int64_t> top{0};
+    alignas(CoroDetail::CacheLineSize) std::atomic<int64_t> bottom{0};
+    std::atomic<Buffer*> buffer{nullptr};
+    std::vector<std::unique_ptr<Buffer>> buffers; // owner only
+
+    Buffer* grow(Buffer* current, int64_t t, int64_t b) {
+        auto next = std::make_unique<Buffer>(current->capacity() * 2);
+        for (auto i = t; i < b; ++i) {
+            next->put(i, current->get(i));
+        }
+        auto* result = next.get();
+        buffers.push_back(std::move(next));
+        buffer.store(result, std::memory_order_release);
+        return result;
+    }
+};
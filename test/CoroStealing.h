@@ -0,0 +1,215 @@
+#pragma once
+#include "CoroQueue.h"
+#include "CoroSyn.h"
+#include "CoroTimer.h"
+#include <atomic>
+#include <coroutine>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+/// Multi-threaded SynCtx: N workers with Chase-Lev deques and work stealing.
+/// - post from a worker pushes to its own deque (LIFO, cache-warm), idle workers steal from the others
+/// - post from a foreign thread goes round-robin into per-worker inboxes (lock-free MPSC)
+/// - post(handle, worker) is an affinity hint: the handle goes to that worker's inbox
+/// - timers share one wheel (locked only by timer operations); a delay resumes on the worker it was
+///   started on, so a coroutine stays on its last worker unless that one is busy and gets robbed
+struct StealingSynCtx {
+    using Task = std::coroutine_handle<>;
+
+    explicit StealingSynCtx(size_t workerCount = std::max(1u, std::thread::hardware_concurrency())) {
+        workers.reserve(workerCount);
+        for (size_t index = 0; index < workerCount; ++index) {
+            workers.push_back(std::make_unique<Worker>());
+        }
+        for (size_t index = 0; index < workerCount; ++index) {
+            workers[index]->thread = std::thread([this, index] { run_worker(index); });
+        }
+    }
+
+    /// Stops and joins workers: coroutines still queued or sleeping are abandoned (not resumed).
+    ~StealingSynCtx() {
+        stopping.store(true, std::memory_order_release);
+        for (auto& worker : workers) {
+            worker->parker.unpark();
+        }
+        for (auto& worker : workers) {
+            worker->thread.join();
+        }
+    }
+
+    StealingSynCtx(const StealingSynCtx&) = delete;
+    StealingSynCtx& operator=(const StealingSynCtx&) = delete;
+
+    void post(Task handle) {
+        if (auto index = current_worker()) {
+            workers[*index]->deque.push(handle);
+            wake_idle(*index);
+        } else {
+            post(handle, nextInbox.fetch_add(1, std::memory_order_relaxed) % workers.size());
+        }
+    }
+
+    /// Affinity hint: resume on the given worker unless it gets stolen from there
+    void post(Task handle, size_t worker) {
+        auto& target = *workers[worker % workers.size()];
+        target.inbox.try_push(handle);
+        target.parker.unpark();
+    }
+
+    void post_at(TimerNode& node, TimerWheel::Clock::time_point deadline) {
+        node.hint = static_cast<uint32_t>(current_worker().value_or(nextInbox.fetch_add(1, std::memory_order_relaxed) % workers.size()));
+        {
+            std::lock_guard lock{timersMutex};
+            timers.schedule(node, deadline);
+            timerCount.store(timers.size(), std::memory_order_relaxed);
+        }
+        if (!current_worker()) {
+            // workers may all be parked without a deadline: let the hinted one recompute it
+            workers[node.hint]->parker.unpark();
+        }
+    }
+
+    bool cancel_timer(TimerNode& node) {
+        std::lock_guard lock{timersMutex};
+        const bool cancelled = timers.cancel(node);
+        timerCount.store(timers.size(), std::memory_order_relaxed);
+        return cancelled;
+    }
+
+    /// Index of the calling worker of this context (nullopt for foreign threads)
+    [[nodiscard]] std::optional<size_t> current_worker() const noexcept {
+        if (currentCtx == this) {
+            return currentIndex;
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] size_t worker_count() const noexcept { return workers.size(); }
+
+    /// Coroutines resumed by other workers than the one they were queued on
+    [[nodiscard]] size_t steal_count() const noexcept { return steals.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t InboxBatch = 64;
+    static constexpr size_t TimerPollInterval = 64; // resumptions between timer polls of a busy worker
+
+    struct Worker {
+        WorkStealingDeque<Task> deque;
+        MpscQueue<Task> inbox;
+        Parker parker;
+        std::atomic<bool> idle{false};
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<bool> stopping{false};
+    std::atomic<size_t> nextInbox{0};
+    std::atomic<size_t> steals{0};
+
+    std::mutex timersMutex;
+    TimerWheel timers;
+    std::atomic<size_t> timerCount{0};
+
+    static inline thread_local const StealingSynCtx* currentCtx = nullptr;
+    static inline thread_local size_t currentIndex = 0;
+
+    void run_worker(size_t index) {
+        currentCtx = this;
+        currentIndex = index;
+        auto& self = *workers[index];
+        std::minstd_rand random{static_cast<unsigned>(index + 1)};
+
+        size_t sincePoll = 0;
+        Task handle;
+        while (!stopping.load(std::memory_order_acquire)) {
+            if (++sincePoll >= TimerPollInterval) {
+                sincePoll = 0;
+                poll_timers();
+            }
+            if (self.deque.pop(handle)) {
+                handle.resume();
+                continue;
+            }
+            if (const auto moved = self.inbox.drain([&self](Task task) { self.deque.push(task); }, InboxBatch); moved > 0) {
+                if (moved > 1) {
+                    wake_idle(index); // all but the one run next is stealable now
+                }
+                continue;
+            }
+            if (poll_timers() > 0) {
+                continue;
+            }
+            if (try_steal(index, random, handle)) {
+                steals.fetch_add(1, std::memory_order_relaxed);
+                wake_idle(index); // the victim had a backlog: pass the wakeup on while stealing succeeds
+                handle.resume();
+                continue;
+            }
+            park(self);
+        }
+        currentCtx = nullptr;
+    }
+
+    size_t poll_timers() {
+        if (timerCount.load(std::memory_order_relaxed) == 0) {
+            return 0;
+        }
+        std::unique_lock lock{timersMutex, std::try_to_lock};
+        if (!lock) {
+            return 0; // another worker is polling
+        }
+        const auto fired = timers.advance(TimerWheel::Clock::now(), [this](TimerNode& node) {
+            auto& target = *workers[node.hint % workers.size()];
+            target.inbox.try_push(node.handle);
+            target.parker.unpark();
+        });
+        timerCount.store(timers.size(), std::memory_order_relaxed);
+        return fired;
+    }
+
+    bool try_steal(size_t thief, std::minstd_rand& random, Task& out) {
+        const auto count = workers.size();
+        if (count < 2) {
+            return false;
+        }
+        const auto start = random() % count;
+        for (size_t offset = 0; offset < count; ++offset) {
+            const auto victim = (start + offset) % count;
+            if (victim != thief && workers[victim]->deque.steal(out)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void park(Worker& self) {
+        std::optional<TimerWheel::Clock::time_point> deadline;
+        if (timerCount.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard lock{timersMutex};
+            deadline = timers.next_deadline();
+        }
+        self.idle.store(true, std::memory_order_seq_cst);
+        if (self.inbox.empty() && !stopping.load(std::memory_order_acquire)) {
+            self.parker.park_until(deadline.value_or(TimerWheel::Clock::time_point::max()));
+        }
+        self.idle.store(false, std::memory_order_relaxed);
+    }
+
+    /// New local work is stealable: wake one parked worker to come and take it
+    void wake_idle(size_t poster) {
+        const auto count = workers.size();
+        for (size_t offset = 1; offset < count; ++offset) {
+            auto& worker = *workers[(poster + offset) % count];
+            if (worker.idle.load(std::memory_order_seq_cst)) {
+                worker.parker.unpark();
+                return;
+            }
+        }
+    }
+};
+
+static_assert(SynCtx<StealingSynCtx>, "StealingSynCtx must satisfy SynCtx concept");
+static_assert(TimerSynCtx<StealingSynCtx>, "StealingSynCtx must satisfy TimerSynCtx concept");
@@ -1,60 +1,313 @@
 #pragma once
+#include "CoroCancel.h"
+#include "CoroQueue.h"
+#include "CoroTimer.h"
+#include <atomic>
 #include <chrono>
+#include <concepts>
 #include <coroutine>
 #include <queue>
 #include <thread>
+#include <utility>
 
 template<typename T>
 concept SynCtx = requires(T ctx, std::coroutine_handle<> handle) {
     ctx.post(handle);
 };
 
-struct QueueSynCtx {
+/// SynCtx owning a timer service: delays are registered in it instead of spawning threads
+template<typename T>
+concept TimerSynCtx = SynCtx<T> && requires(T ctx, TimerNode& node, TimerWheel::Clock::time_point deadline) {
+    ctx.post_at(node, deadline);
+    { ctx.cancel_timer(node) } -> std::same_as<bool>;
+};
+
+/// Run queue context: posts are accepted from any thread through a lock-free MPSC queue,
+/// while timers and resumption are driven by the single consumer thread (run_*/wait).
+/// `Queue` selects the mode: unbounded (MpscQueue) or bounded (BoundedMpscQueue, post backs off while full).
+/// A post from a task run here never waits: when the queue is full it goes to the consumer-local ready list.
+template<typename Queue>
+struct BasicQueueSynCtx {
     using Task = std::coroutine_handle<>;
 
-    void post(Task handle) { tasks.push(handle); }
+    template<typename... Args>
+    explicit BasicQueueSynCtx(Args&&... args)
+        : tasks(std::forward<Args>(args)...) {}
+
+    /// Waits for remote posters still waking the consumer: their task may already have run.
+    ~BasicQueueSynCtx() { wait_posters(); }
+
+    BasicQueueSynCtx(const BasicQueueSynCtx&) = delete;
+    BasicQueueSynCtx& operator=(const BasicQueueSynCtx&) = delete;
+
+    /// Thread-safe. In bounded mode a full queue makes a remote producer wait for the consumer,
+    /// while the consumer itself (inside run_*) overflows into its local ready list: it can't wait for itself.
+    /// Outside of run_* the consumer thread must not post into a full queue.
+    void post(Task handle) {
+        PosterScope scope{posters};
+        unsigned spins = 0;
+        while (!tasks.try_push(handle)) {
+            if (running == this) {
+                ready.push(handle);
+                return;
+            }
+            CoroDetail::cpu_relax(spins);
+        }
+        parker.unpark();
+    }
+
+    bool try_post(Task handle) {
+        PosterScope scope{posters};
+        if (!tasks.try_push(handle)) {
+            return false;
+        }
+        parker.unpark();
+        return true;
+    }
+
+    /// Consumer thread only (also outside of run_*): never waits, a full queue overflows into the local ready list
+    void post_local(Task handle) {
+        if (!tasks.try_push(handle)) {
+            ready.push(handle);
+        }
+    }
+
+    /// Post node's handle once the deadline is reached (node must stay alive until then).
+    /// Consumer thread only.
+    void post_at(TimerNode& node, TimerWheel::Clock::time_point deadline) { timers.schedule(node, deadline); }
+
+    /// Remove a pending timer without posting it, returns false if it already fired. Consumer thread only.
+    bool cancel_timer(TimerNode& node) { return timers.cancel(node); }
+
+    /// Move due timers into the consumer-local ready list, returns the number of fired ones
+    size_t poll_timers() {
+        if (timers.empty()) {
+            return 0;
+        }
+        return timers.advance(TimerWheel::Clock::now(), [this](TimerNode& node) { ready.push(node.handle); });
+    }
 
     bool run_once() {
-        if (tasks.empty()) {
+        poll_timers();
+        Task handle;
+        if (!ready.empty()) {
+            handle = ready.front();
+            ready.pop();
+        } else if (!tasks.try_pop(handle)) {
             return false;
         }
-        auto handle = tasks.front();
-        tasks.pop();
+        RunningScope scope{this};
         handle.resume();
         return true;
     }
 
+    /// Run until nothing is ready, draining the queue in batches between timer polls
     void run_all() {
-        while (run_once()) {
-            ; // continue running tasks
+        static constexpr size_t BatchSize = 256;
+        RunningScope scope{this};
+        for (;;) {
+            poll_timers();
+            size_t count = 0;
+            for (; count < BatchSize && !ready.empty(); ++count) {
+                auto handle = ready.front();
+                ready.pop();
+                handle.resume();
+            }
+            count += tasks.drain([](Task handle) { handle.resume(); }, BatchSize);
+            if (count == 0) {
+                break;
+            }
+        }
+    }
+
+    /// Run tasks until `done()` holds, sleeping in wait() while idle: woken directly by post or the nearest timer.
+    /// `done` must only change from tasks run here (or be followed by a post), otherwise the wait won't notice it.
+    /// Returns once the posters of the tasks run here are done with the context, so it can be torn down.
+    template<typename Predicate>
+    void run_until(Predicate&& done) {
+        while (!done()) {
+            if (!run_once()) {
+                wait();
+            }
+        }
+        wait_posters();
+    }
+
+    /// Same as run_until but gives up at the deadline, returns whether `done()` was reached.
+    template<typename Predicate>
+    bool run_until(Predicate&& done, TimerWheel::Clock::time_point deadline) {
+        while (!done()) {
+            if (run_once()) {
+                continue;
+            }
+            if (TimerWheel::Clock::now() >= deadline) {
+                return false;
+            }
+            wait_until(deadline);
+        }
+        wait_posters();
+        return true;
+    }
+
+    /// Sleep until a post arrives or the nearest timer is due (returns immediately when work is ready)
+    void wait() { wait_until(TimerWheel::Clock::time_point::max()); }
+
+    /// wait() limited by the deadline
+    void wait_until(TimerWheel::Clock::time_point deadline) {
+        if (!ready.empty() || !tasks.empty()) {
+            return;
         }
+        if (auto timerDeadline = timers.next_deadline()) {
+            deadline = std::min(deadline, *timerDeadline);
+        }
+        parker.park_until(deadline);
     }
 
-    [[nodiscard]] bool empty() const noexcept { return tasks.empty(); }
+    [[nodiscard]] bool empty() const noexcept { return ready.empty() && tasks.empty() && timers.empty(); }
+
+    [[nodiscard]] const TimerWheel& get_timers() const noexcept { return timers; }
 
 private:
-    std::queue<Task> tasks;
+    /// Counts a post from before its push until after its unpark: the pushed task can run (and end
+    /// the context's lifetime) before the poster leaves, teardown waits on the count instead.
+    struct PosterScope {
+        std::atomic<size_t>& count;
+
+        explicit PosterScope(std::atomic<size_t>& count) noexcept
+            : count(count) { count.fetch_add(1, std::memory_order_relaxed); }
+        ~PosterScope() { count.fetch_sub(1, std::memory_order_release); }
+        PosterScope(const PosterScope&) = delete;
+        PosterScope& operator=(const PosterScope&) = delete;
+    };
+
+    /// Marks the calling thread as this context's consumer while it resumes tasks
+    class RunningScope {
+    public:
+        explicit RunningScope(const BasicQueueSynCtx* ctx) noexcept
+            : previous(std::exchange(running, ctx)) {}
+        ~RunningScope() { running = previous; }
+        RunningScope(const RunningScope&) = delete;
+        RunningScope& operator=(const RunningScope&) = delete;
+
+    private:
+        const BasicQueueSynCtx* previous;
+    };
+
+    void wait_posters() const noexcept {
+        unsigned spins = 0;
+        while (posters.load(std::memory_order_acquire) != 0) {
+            CoroDetail::cpu_relax(spins);
+        }
+    }
+
+    Queue tasks;
+    Parker parker;
+    std::atomic<size_t> posters{0};
+    std::queue<Task> ready; // consumer-local: fired timers and posts that overflowed a full queue
+    TimerWheel timers;
+
+    static inline thread_local const BasicQueueSynCtx* running = nullptr;
 };
 
+using QueueSynCtx = BasicQueueSynCtx<MpscQueue<std::coroutine_handle<>>>;
+using BoundedQueueSynCtx = BasicQueueSynCtx<BoundedMpscQueue<std::coroutine_handle<>>>;
+
 static_assert(SynCtx<QueueSynCtx>, "QueueSynCtx must satisfy SynCtx concept");
+static_assert(TimerSynCtx<QueueSynCtx>, "QueueSynCtx must satisfy TimerSynCtx concept");
+static_assert(SynCtx<BoundedQueueSynCtx>, "BoundedQueueSynCtx must satisfy SynCtx concept");
+
+/// Post from the thread driving the context (as its timer and cancel callbacks do): contexts with
+/// a consumer-local ready list never block there, even when their queue is bounded and full.
+template<SynCtx SynCtx>
+inline void post_from_consumer(SynCtx& synCtx, std::coroutine_handle<> handle) {
+    if constexpr (requires { synCtx.post_local(handle); }) {
+        synCtx.post_local(handle);
+    } else {
+        synCtx.post(handle);
+    }
+}
 
 template<SynCtx SynCtx>
 struct DelayAwaiter {
     std::chrono::milliseconds delay;
     SynCtx* synCtx;
+    CancellationToken token{};
+    TimerNode node{};
+    CancellationRegistration registration{};
+    bool cancelled = false;
+
+    DelayAwaiter(std::chrono::milliseconds delay, SynCtx* synCtx, CancellationToken token = {}) noexcept
+        : delay(delay)
+        , synCtx(synCtx)
+        , token(token) {}
 
-    [[nodiscard]] bool await_ready() const noexcept { return false; }
-    void await_suspend(std::coroutine_handle<> handle) const {
-        // Emulate async — "sleep" in a separate thread, then schedule resumption in synCtx.
-        std::thread([handle, duration = delay, synCtx = this->synCtx] {
-            std::this_thread::sleep_for(duration);
-            synCtx->post(handle);
-        }).detach();
+    /// Copies start unscheduled and unregistered: only done before awaiting (e.g. into a when_all child)
+    DelayAwaiter(const DelayAwaiter& other) noexcept
+        : DelayAwaiter(other.delay, other.synCtx, other.token) {}
+    DelayAwaiter& operator=(const DelayAwaiter&) = delete;
+
+    ~DelayAwaiter() {
+        if constexpr (TimerSynCtx<SynCtx>) {
+            if (node.linked()) {
+                synCtx->cancel_timer(node); // frame destroyed while suspended
+            }
+        }
+    }
+
+    [[nodiscard]] bool await_ready() noexcept {
+        cancelled = token.is_cancellation_requested();
+        return cancelled;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+        if constexpr (TimerSynCtx<SynCtx>) {
+            // Registered in the context's timer service: no thread, no allocation (node lives in the frame).
+            // The cancel callback is registered before the timer is armed (and can't run until it is),
+            // then the timer firing and cancel_timer race for the node in the context: whichever unlinks it
+            // resumes the coroutine. Nothing here touches the awaiter once the timer is armed.
+            node.handle = handle;
+            const auto deadline = TimerWheel::Clock::now() + delay;
+            if (!registration.register_callback(token, &DelayAwaiter::on_cancel, this, [this, deadline] { synCtx->post_at(node, deadline); })) {
+                cancelled = true; // requested after await_ready
+                return false;
+            }
+        } else {
+            // Emulate async — "sleep" in a separate thread, then schedule resumption in synCtx.
+            std::thread([handle, duration = delay, synCtx = this->synCtx] {
+                std::this_thread::sleep_for(duration);
+                synCtx->post(handle);
+            }).detach();
+        }
+        return true;
+    }
+
+    /// Returns false when the delay was cut short by cancellation
+    bool await_resume() noexcept {
+        registration.reset();
+        return !cancelled;
+    }
+
+private:
+    /// The awaiter is alive while it runs: a resumption by the timer waits for it in registration.reset()
+    static void on_cancel(void* context) {
+        auto& self = *static_cast<DelayAwaiter*>(context);
+        if constexpr (TimerSynCtx<SynCtx>) {
+            // removed from the timer wheel right away and resumed through the run queue
+            if (self.synCtx->cancel_timer(self.node)) {
+                self.cancelled = true;
+                post_from_consumer(*self.synCtx, self.node.handle);
+            }
+        }
     }
-    void await_resume() const noexcept {}
 };
 
 template<SynCtx SynCtx>
 inline DelayAwaiter<SynCtx> delay_for(std::chrono::milliseconds duration, SynCtx& synCtx) {
     return {duration, &synCtx};
 }
+
+/// Cancellable delay: cancellation removes the timer and resumes the awaiter early (co_await yields false)
+template<TimerSynCtx SynCtx>
+inline DelayAwaiter<SynCtx> delay_for(std::chrono::milliseconds duration, SynCtx& synCtx, CancellationToken token) {
+    return {duration, &synCtx, token};
+}
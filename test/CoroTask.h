@@ -0,0 +1,184 @@
+#pragma once
+#include "CoroFramePool.h"
+#include "CoroSyn.h"
+#include <coroutine>
+#include <exception>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+template<typename T = void>
+class Task;
+
+namespace CoroDetail
+{
+    /// Resumes the awaiting coroutine by symmetric transfer: deep await chains don't grow the stack
+    struct TaskFinalAwaiter {
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept {
+            if (auto continuation = handle.promise().continuation) {
+                return continuation;
+            }
+            return std::noop_coroutine();
+        }
+        void await_resume() const noexcept {}
+    };
+
+    struct TaskPromiseBase : PooledFrame {
+        std::coroutine_handle<> continuation;
+
+        std::suspend_always initial_suspend() const noexcept { return {}; } // lazy start
+        TaskFinalAwaiter final_suspend() const noexcept { return {}; }
+    };
+
+    template<typename T>
+    struct TaskPromise : TaskPromiseBase {
+        std::variant<std::monostate, T, std::exception_ptr> result;
+
+        Task<T> get_return_object() noexcept;
+
+        template<typename U = T>
+            requires std::is_convertible_v<U&&, T>
+        void return_value(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>) {
+            result.template emplace<1>(std::forward<U>(value));
+        }
+        void unhandled_exception() noexcept { result.template emplace<2>(std::current_exception()); }
+
+        T take_result() {
+            if (result.index() == 2) {
+                std::rethrow_exception(std::get<2>(result));
+            }
+            return std::move(std::get<1>(result));
+        }
+    };
+
+    template<>
+    struct TaskPromise<void> : TaskPromiseBase {
+        std::exception_ptr exception;
+
+        Task<void> get_return_object() noexcept;
+
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+        void take_result() const {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    };
+}
+
+/// Lazily started, move-only coroutine producing T (or rethrowing its exception) to the awaiter.
+/// The body starts when the task is awaited and the awaiter is resumed by symmetric transfer when it ends,
+/// so resumption happens on whatever context finished the body (see schedule_on to hop to a SynCtx).
+/// Frames come from FramePool.
+template<typename T>
+class [[nodiscard]] Task {
+public:
+    using promise_type = CoroDetail::TaskPromise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Task() noexcept = default;
+    explicit Task(Handle handle) noexcept
+        : handle(handle) {}
+    Task(Task&& other) noexcept
+        : handle(std::exchange(other.handle, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            reset();
+            handle = std::exchange(other.handle, {});
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() { reset(); }
+
+    [[nodiscard]] bool valid() const noexcept { return static_cast<bool>(handle); }
+    [[nodiscard]] bool done() const noexcept { return handle && handle.done(); }
+
+    /// Throws std::logic_error for an empty (default constructed, moved-from or released) task
+    auto operator co_await() && {
+        if (!handle) {
+            throw std::logic_error("awaiting an empty Task");
+        }
+        struct Awaiter {
+            Handle handle;
+
+            [[nodiscard]] bool await_ready() const noexcept { return handle.done(); }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+            T await_resume() const { return handle.promise().take_result(); }
+        };
+        return Awaiter{handle};
+    }
+
+    /// Hand over the frame ownership (e.g. to a detached runner)
+    [[nodiscard]] Handle release() noexcept { return std::exchange(handle, {}); }
+
+private:
+    Handle handle;
+
+    void reset() noexcept {
+        if (handle) {
+            handle.destroy();
+            handle = {};
+        }
+    }
+};
+
+template<typename T>
+Task<T> CoroDetail::TaskPromise<T>::get_return_object() noexcept {
+    return Task<T>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+}
+
+inline Task<void> CoroDetail::TaskPromise<void>::get_return_object() noexcept {
+    return Task<void>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+}
+
+/// Resume the awaiting coroutine from the context's run queue
+template<SynCtx SynCtx>
+struct ScheduleAwaiter {
+    SynCtx* synCtx;
+
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) const { synCtx->post(handle); }
+    void await_resume() const noexcept {}
+};
+
+template<SynCtx SynCtx>
+inline ScheduleAwaiter<SynCtx> schedule_on(SynCtx& synCtx) {
+    return {&synCtx};
+}
+
+namespace CoroDetail
+{
+    /// Eagerly started fire-and-forget owner of a spawned task, its frame is destroyed on completion
+    struct SpawnedTask {
+        struct promise_type : PooledFrame {
+            SpawnedTask get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() const noexcept { return {}; }
+            std::suspend_never final_suspend() const noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+    template<SynCtx SynCtx>
+    SpawnedTask spawn_on(SynCtx& synCtx, Task<void> task) {
+        co_await schedule_on(synCtx);
+        co_await std::move(task);
+    }
+}
+
+/// Start the task on the context (first resumed from its run queue) without awaiting it.
+/// An exception escaping the task terminates, as nobody can observe it.
+template<SynCtx SynCtx>
+void spawn(SynCtx& synCtx, Task<void> task) {
+    CoroDetail::spawn_on(synCtx, std::move(task));
+}
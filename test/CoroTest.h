@@ -1,9 +1,14 @@
 #pragma once
 #include "CoroSyn.h"
 #include "Log/Log.h"
+#include <atomic>
 #include <gtest/gtest.h>
 
-struct CoroTest : testing::Test {
+/// Marks fixtures whose TEST_F bodies are coroutines (see coroutine_traits below)
+struct CoroTestBase : testing::Test {};
+
+template<SynCtx SynCtxType>
+struct BasicCoroTest : CoroTestBase {
     void SetUp() override { 
         const auto* test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
         Log::Debug("CoroTest: {}: SetUp", test_name);
@@ -12,30 +17,35 @@ struct CoroTest : testing::Test {
     void TearDown() override {
         const auto* test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
         Log::Debug("CoroTest: {}: >>>>", test_name);
-        while (!coroutineCompleted) {
-            if (!synCtx.run_once()) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-            }
+        if constexpr (requires { synCtx.run_until([] { return true; }); }) {
+            // single-threaded context: run it here until the test body completes
+            synCtx.run_until([this] { return coroutineCompleted.load(std::memory_order_acquire); });
+        } else {
+            // context with its own threads: just wait for completion
+            coroutineCompleted.wait(false, std::memory_order_acquire);
+        }
+        if constexpr (requires { synCtx.empty(); }) {
+            ASSERT_TRUE(synCtx.empty());
         }
-        ASSERT_TRUE(synCtx.empty());
         Log::Debug("CoroTest: {}: <<<<", test_name);
     }
 
-    QueueSynCtx synCtx;
-    bool coroutineCompleted = {};
+    std::atomic<bool> coroutineCompleted = {};
+    SynCtxType synCtx; // destroyed first: threaded contexts join their workers before the flag goes away
 
     struct Promise {
-        CoroTest& testInstance;
+        BasicCoroTest& testInstance;
 
         /// Constructor automatically receives reference to CoroTest object
-        Promise(CoroTest& test) noexcept : testInstance(test) {}
+        Promise(BasicCoroTest& test) noexcept : testInstance(test) {}
         /// The coroutine's return object is void for test functions
         void get_return_object() noexcept {}
 
         struct InitialSuspend {
             bool await_ready() noexcept { return false; }
             void await_suspend(std::coroutine_handle<Promise> handle) noexcept { 
-                handle.promise().testInstance.synCtx.post(handle);
+                // the test thread is the one running single-threaded contexts in TearDown
+                post_from_consumer(handle.promise().testInstance.synCtx, handle);
             }
             void await_resume() noexcept {}
         };
@@ -45,7 +55,9 @@ struct CoroTest : testing::Test {
         struct FinalAwaiter {
             bool await_ready() noexcept { return false; }
             void await_suspend(std::coroutine_handle<Promise> handle) noexcept { 
-                handle.promise().testInstance.coroutineCompleted = true;
+                auto& completed = handle.promise().testInstance.coroutineCompleted;
+                completed.store(true, std::memory_order_release);
+                completed.notify_all();
             }
             void await_resume() noexcept {}
         };
@@ -60,10 +72,12 @@ struct CoroTest : testing::Test {
     };
 };
 
+using CoroTest = BasicCoroTest<QueueSynCtx>;
+
 namespace std {
     template <typename T>
-    requires std::is_base_of_v<CoroTest, T>
+    requires std::is_base_of_v<CoroTestBase, T>
     struct coroutine_traits<void, T&> {
-        using promise_type = CoroTest::Promise;
+        using promise_type = typename T::Promise;
     };
 }
@@ -0,0 +1,220 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+/// Intrusive timer entry: lives inside the awaiter (i.e. inside the suspended coroutine frame),
+/// so scheduling and cancelling never allocate.
+struct TimerNode {
+    TimerNode* prev = nullptr;
+    TimerNode* next = nullptr;
+    uint64_t expireTick = 0;
+    std::chrono::steady_clock::time_point deadline{};
+    std::coroutine_handle<> handle;
+    uint32_t hint = 0; // opaque to the wheel: owning context's resumption hint (e.g. worker affinity)
+
+    [[nodiscard]] bool linked() const noexcept { return next != nullptr; }
+};
+
+/// Single-threaded hierarchical timer wheel (Varghese & Lauck; the classic Linux layout).
+/// - schedule/cancel are O(1): a node is linked into the slot chosen by its expiration tick
+/// - advance fires due nodes in batches, cascading coarser levels down as ticks wrap
+/// Deadlines and `now` are both floored to ticks: a node sits in the tick its deadline falls into and
+/// fires on the first advance at or after the exact deadline (the current tick stays open until then).
+/// Not thread-safe: owned and driven by a single SynCtx thread.
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Resolution = std::chrono::milliseconds;
+
+    static constexpr unsigned SlotBits = 6;
+    static constexpr unsigned SlotCount = 1u << SlotBits;
+    static constexpr unsigned LevelCount = 4;
+    /// Farthest tick distance representable by the levels (longer delays are re-cascaded)
+    static constexpr uint64_t MaxSpan = (uint64_t{1} << (SlotBits * LevelCount)) - 1;
+
+    explicit TimerWheel(Clock::time_point origin = Clock::now()) noexcept
+        : origin(origin) {
+        for (auto& level : slots) {
+            for (auto& head : level) {
+                head.prev = head.next = &head;
+            }
+        }
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /// Link the node to fire its handle at (or after) the deadline.
+    void schedule(TimerNode& node, Clock::time_point deadline) noexcept {
+        node.deadline = deadline;
+        node.expireTick = std::max(to_tick(deadline), nextTick);
+        link(node);
+        ++count;
+    }
+
+    /// Unlink a pending node; returns false when it has already fired (or was never scheduled).
+    bool cancel(TimerNode& node) noexcept {
+        if (!node.linked()) {
+            return false;
+        }
+        unlink(node);
+        --count;
+        return true;
+    }
+
+    /// Process all ticks up to `now`, calling `fire(node)` for each node whose deadline is reached.
+    /// Nodes are unlinked before `fire` is invoked so they may be rescheduled from it
+    /// (the node must not be touched after the handle was handed over for resumption).
+    template<typename Fire>
+    size_t advance(Clock::time_point now, Fire&& fire) {
+        const auto target = to_tick(now);
+        size_t fired = 0;
+        while (nextTick <= target && count > 0) {
+            const auto index = slot_index(nextTick, 0);
+            if (index == 0) {
+                cascade(1); // no-op when repeated for the open tick: the slot was already moved down
+            }
+
+            // Detach the whole slot first: fired handlers may schedule into the same slot again.
+            auto& head = slots[0][index];
+            TimerNode pending;
+            pending.prev = pending.next = &pending;
+            while (head.next != &head) {
+                TimerNode batch;
+                splice(head, batch);
+                while (batch.next != &batch) {
+                    auto& node = *batch.next;
+                    unlink(node);
+                    if (node.expireTick > nextTick) {
+                        link(node); // clamped beyond MaxSpan: wait for the next round
+                        continue;
+                    }
+                    if (node.deadline > now) {
+                        insert(pending, node); // later in the current tick
+                        continue;
+                    }
+                    --count;
+                    ++fired;
+                    fire(node);
+                }
+            }
+            splice(pending, head);
+            if (nextTick == target) {
+                break; // keep the current tick open for deadlines later in it
+            }
+            ++nextTick;
+        }
+        nextTick = std::max(nextTick, target);
+        return fired;
+    }
+
+    /// Lower bound of the earliest deadline, to limit a blocking wait (exact for level-0 entries).
+    [[nodiscard]] std::optional<Clock::time_point> next_deadline() const noexcept {
+        if (count == 0) {
+            return std::nullopt;
+        }
+        auto earliest = Clock::time_point::max();
+        for (unsigned offset = 0; offset < SlotCount; ++offset) {
+            const auto& head = slots[0][(nextTick + offset) & (SlotCount - 1)];
+            if (head.next != &head) {
+                for (const auto* node = head.next; node != &head; node = node->next) {
+                    earliest = std::min(earliest, node->deadline);
+                }
+                break;
+            }
+        }
+        for (unsigned level = 1; level < LevelCount; ++level) {
+            const auto shift = SlotBits * level;
+            const auto base = nextTick >> shift;
+            for (unsigned offset = 0; offset < SlotCount; ++offset) {
+                const auto& head = slots[level][(base + offset) & (SlotCount - 1)];
+                if (head.next != &head) {
+                    // coarser levels never hold the current tick (it's cascaded down when entered)
+                    const auto tick = std::max((base + offset) << shift, nextTick + 1);
+                    earliest = std::min(earliest, origin + Resolution(tick));
+                    break;
+                }
+            }
+        }
+        return earliest;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return count == 0; }
+    [[nodiscard]] size_t size() const noexcept { return count; }
+
+private:
+    Clock::time_point origin;
+    uint64_t nextTick = 0; // first tick not completely processed yet (the current one stays open)
+    size_t count = 0;
+    std::array<std::array<TimerNode, SlotCount>, LevelCount> slots;
+
+    /// Tick containing the time point (same rounding for deadlines and `now`)
+    [[nodiscard]] uint64_t to_tick(Clock::time_point tp) const noexcept {
+        const auto ticks = std::chrono::floor<Resolution>(tp - origin).count();
+        return ticks > 0 ? static_cast<uint64_t>(ticks) : 0;
+    }
+
+    static unsigned slot_index(uint64_t tick, unsigned level) noexcept {
+        return static_cast<unsigned>(tick >> (SlotBits * level)) & (SlotCount - 1);
+    }
+
+    void link(TimerNode& node) noexcept {
+        const auto delta = std::min(node.expireTick - nextTick, MaxSpan);
+        const auto placeTick = nextTick + delta;
+        unsigned level = 0;
+        while (level + 1 < LevelCount && delta >= (uint64_t{1} << (SlotBits * (level + 1)))) {
+            ++level;
+        }
+        insert(slots[level][slot_index(placeTick, level)], node);
+    }
+
+    /// Append the node to the list of `head`
+    static void insert(TimerNode& head, TimerNode& node) noexcept {
+        node.prev = head.prev;
+        node.next = &head;
+        head.prev->next = &node;
+        head.prev = &node;
+    }
+
+    static void unlink(TimerNode& node) noexcept {
+        node.prev->next = node.next;
+        node.next->prev = node.prev;
+        node.prev = node.next = nullptr;
+    }
+
+    /// Move all nodes of `from` list into empty `to` list.
+    static void splice(TimerNode& from, TimerNode& to) noexcept {
+        if (from.next == &from) {
+            to.prev = to.next = &to;
+            return;
+        }
+        to.next = from.next;
+        to.prev = from.prev;
+        to.next->prev = &to;
+        to.prev->next = &to;
+        from.prev = from.next = &from;
+    }
+
+    /// Re-distribute the current slot of `level` into finer levels (recursively when it wraps too).
+    void cascade(unsigned level) noexcept {
+        if (level >= LevelCount) {
+            return;
+        }
+        const auto index = slot_index(nextTick, level);
+        if (index == 0) {
+            cascade(level + 1);
+        }
+        TimerNode batch;
+        splice(slots[level][index], batch);
+        while (batch.next != &batch) {
+            auto& node = *batch.next;
+            unlink(node);
+            link(node);
+        }
+    }
+};
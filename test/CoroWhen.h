@@ -0,0 +1,198 @@
+#pragma once
+#include "CoroCancel.h"
+#include "CoroFramePool.h"
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace CoroDetail
+{
+    template<typename Awaitable>
+    decltype(auto) get_awaiter(Awaitable&& awaitable) {
+        if constexpr (requires { std::forward<Awaitable>(awaitable).operator co_await(); }) {
+            return std::forward<Awaitable>(awaitable).operator co_await();
+        } else {
+            return std::forward<Awaitable>(awaitable);
+        }
+    }
+
+    template<typename Awaitable>
+    using AwaitResult = decltype(get_awaiter(std::declval<Awaitable>()).await_resume());
+
+    /// Value stored for an awaitable's result: void becomes std::monostate
+    template<typename Awaitable>
+    using WhenValue = std::conditional_t<
+        std::is_void_v<AwaitResult<Awaitable>>,
+        std::monostate,
+        std::decay_t<AwaitResult<Awaitable>>>;
+
+    struct WhenState {
+        static constexpr size_t NoWinner = SIZE_MAX;
+
+        std::atomic<size_t> remaining{0};
+        std::atomic<size_t> winner{NoWinner};
+        std::coroutine_handle<> parent;
+        CancellationSource* source = nullptr; // cancelled when the first child completes (when_any)
+    };
+
+    /// Wrapper coroutine running one awaitable of a combinator, its frame comes from FramePool
+    template<typename T>
+    class WhenChild {
+    public:
+        struct promise_type : PooledFrame {
+            WhenState* state = nullptr;
+            size_t index = 0;
+            std::variant<std::monostate, T, std::exception_ptr> result;
+
+            WhenChild get_return_object() noexcept { return WhenChild{Handle::from_promise(*this)}; }
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+
+            struct FinalAwaiter {
+                [[nodiscard]] bool await_ready() const noexcept { return false; }
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) const noexcept {
+                    auto& promise = handle.promise();
+                    auto* state = promise.state;
+                    auto expected = WhenState::NoWinner;
+                    if (state->winner.compare_exchange_strong(expected, promise.index, std::memory_order_acq_rel) && state->source) {
+                        state->source->request_cancel();
+                    }
+                    if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        return state->parent; // the last one resumes the combinator's awaiter
+                    }
+                    return std::noop_coroutine();
+                }
+                void await_resume() const noexcept {}
+            };
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+
+            template<typename U>
+            void return_value(U&& value) {
+                result.template emplace<1>(std::forward<U>(value));
+            }
+            void unhandled_exception() noexcept { result.template emplace<2>(std::current_exception()); }
+        };
+        using Handle = std::coroutine_handle<promise_type>;
+
+        explicit WhenChild(Handle handle) noexcept
+            : handle(handle) {}
+        WhenChild(WhenChild&& other) noexcept
+            : handle(std::exchange(other.handle, {})) {}
+        WhenChild& operator=(WhenChild&&) = delete;
+        ~WhenChild() {
+            if (handle) {
+                handle.destroy();
+            }
+        }
+
+        void start(WhenState& state, size_t index) {
+            handle.promise().state = &state;
+            handle.promise().index = index;
+            handle.resume();
+        }
+
+        T take() {
+            auto& result = handle.promise().result;
+            if (result.index() == 2) {
+                std::rethrow_exception(std::get<2>(result));
+            }
+            return std::move(std::get<1>(result));
+        }
+
+    private:
+        Handle handle;
+    };
+
+    template<typename Awaitable>
+    WhenChild<WhenValue<Awaitable>> make_when_child(Awaitable awaitable) {
+        if constexpr (std::is_void_v<AwaitResult<Awaitable>>) {
+            co_await std::move(awaitable);
+            co_return std::monostate{};
+        } else {
+            co_return co_await std::move(awaitable);
+        }
+    }
+
+    /// Starts all children on await and resumes the awaiter once every child has completed
+    template<typename... Ts>
+    class WhenAwaitableBase {
+    public:
+        explicit WhenAwaitableBase(WhenChild<Ts>... children, CancellationSource* source = nullptr)
+            : children(std::move(children)...) {
+            state.source = source;
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept { return sizeof...(Ts) == 0; }
+
+        bool await_suspend(std::coroutine_handle<> parent) {
+            state.parent = parent;
+            // one extra count held while starting, so a child completing synchronously can't resume the parent early
+            state.remaining.store(sizeof...(Ts) + 1, std::memory_order_relaxed);
+            start(std::index_sequence_for<Ts...>{});
+            return state.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+        }
+
+    protected:
+        std::tuple<WhenChild<Ts>...> children;
+        WhenState state;
+
+    private:
+        template<size_t... Is>
+        void start(std::index_sequence<Is...>) {
+            (std::get<Is>(children).start(state, Is), ...);
+        }
+    };
+
+    template<typename... Ts>
+    class WhenAllAwaitable : public WhenAwaitableBase<Ts...> {
+    public:
+        using WhenAwaitableBase<Ts...>::WhenAwaitableBase;
+
+        std::tuple<Ts...> await_resume() {
+            return std::apply([](auto&... children) { return std::tuple<Ts...>{children.take()...}; }, this->children);
+        }
+    };
+
+    template<typename... Ts>
+    class WhenAnyAwaitable : public WhenAwaitableBase<Ts...> {
+    public:
+        WhenAnyAwaitable(CancellationSource& source, WhenChild<Ts>... children)
+            : WhenAwaitableBase<Ts...>(std::move(children)..., &source) {}
+
+        std::variant<Ts...> await_resume() { return take_winner(std::index_sequence_for<Ts...>{}); }
+
+    private:
+        template<size_t... Is>
+        std::variant<Ts...> take_winner(std::index_sequence<Is...>) {
+            const auto winner = this->state.winner.load(std::memory_order_acquire);
+            std::optional<std::variant<Ts...>> result;
+            (void)((winner == Is && (result.emplace(std::in_place_index<Is>, std::get<Is>(this->children).take()), true)) || ...);
+            return std::move(*result);
+        }
+    };
+}
+
+/// Await all awaitables concurrently, yielding a tuple of their results (void results become std::monostate).
+/// Awaitables are taken by value and started when the combinator is awaited; an exception of any child
+/// is rethrown (the first by position) after all of them completed.
+template<typename... Awaitables>
+[[nodiscard]] auto when_all(Awaitables... awaitables) {
+    return CoroDetail::WhenAllAwaitable<CoroDetail::WhenValue<Awaitables>...>{
+        CoroDetail::make_when_child(std::move(awaitables))...};
+}
+
+/// Await the first awaitable to complete, yielding a variant indexed by the winner.
+/// When the winner completes `source` is cancelled, so awaitables built with its token (e.g. cancellable
+/// delay_for) finish early; the combinator still waits for every child (no detached leftovers).
+/// Losers' results and exceptions are discarded.
+template<typename... Awaitables>
+[[nodiscard]] auto when_any(CancellationSource& source, Awaitables... awaitables) {
+    static_assert(sizeof...(Awaitables) > 0, "when_any requires at least one awaitable");
+    return CoroDetail::WhenAnyAwaitable<CoroDetail::WhenValue<Awaitables>...>{
+        source, CoroDetail::make_when_child(std::move(awaitables))...};
+}
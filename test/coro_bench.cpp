@@ -0,0 +1,184 @@
+#include "CoroStealing.h"
+#include "CoroTask.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Run with `--benchmark_format=json` (or `--benchmark_out=<file> --benchmark_out_format=json`) to track results.
+
+using namespace std::chrono_literals;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+    /// Posts and resumes itself `count` times through the context, recording post-to-resume latency
+    Task<void> hop(auto& synCtx, size_t count, std::vector<Clock::duration>* latencies) {
+        for (size_t i = 0; i < count; ++i) {
+            const auto posted = Clock::now();
+            co_await schedule_on(synCtx);
+            if (latencies) {
+                latencies->push_back(Clock::now() - posted);
+            }
+        }
+    }
+
+    void set_latency_counters(benchmark::State& state, std::vector<Clock::duration>& latencies) {
+        if (latencies.empty()) {
+            return;
+        }
+        std::ranges::sort(latencies);
+        const auto at = [&latencies](double quantile) {
+            const auto index = static_cast<size_t>(quantile * static_cast<double>(latencies.size() - 1));
+            return std::chrono::duration<double, std::nano>(latencies[index]).count();
+        };
+        state.counters["p50_ns"] = at(0.50);
+        state.counters["p99_ns"] = at(0.99);
+        state.counters["max_ns"] = at(1.0);
+    }
+
+    void set_frame_counters(benchmark::State& state, const FramePool::Stats& frames) {
+        state.counters["frames"] = benchmark::Counter(static_cast<double>(frames.allocations), benchmark::Counter::kAvgIterations);
+        state.counters["frame_sys_allocs"] = benchmark::Counter(static_cast<double>(frames.systemAllocations), benchmark::Counter::kAvgIterations);
+    }
+}
+
+/// Post/resume throughput of the single-threaded run queue (one coroutine bouncing through it)
+static void BM_QueuePostResume(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    QueueSynCtx synCtx;
+    std::vector<Clock::duration> latencies;
+    latencies.reserve(count);
+    for (auto _ : state) {
+        latencies.clear();
+        bool done = false;
+        spawn(synCtx, [](QueueSynCtx& synCtx, size_t count, std::vector<Clock::duration>& latencies, bool& done) -> Task<void> {
+            co_await hop(synCtx, count, &latencies);
+            done = true;
+        }(synCtx, count, latencies, done));
+        synCtx.run_until([&done] { return done; });
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+    set_latency_counters(state, latencies);
+}
+BENCHMARK(BM_QueuePostResume)->Arg(100'000);
+
+/// Same hop loop on the work-stealing context, with `range(1)` coroutines hopping concurrently
+static void BM_StealingPostResume(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto fibers = static_cast<size_t>(state.range(1));
+    // declared before the context: the last fiber may still notify after the wait below saw zero,
+    // so the counter lives on until the workers are joined
+    std::atomic<size_t> remaining{0};
+    StealingSynCtx synCtx{static_cast<size_t>(state.range(2))};
+    std::vector<std::vector<Clock::duration>> latencies(fibers);
+    for (auto& fiberLatencies : latencies) {
+        fiberLatencies.reserve(count);
+    }
+    for (auto _ : state) {
+        remaining.store(fibers, std::memory_order_relaxed);
+        for (auto& fiberLatencies : latencies) {
+            fiberLatencies.clear();
+            spawn(synCtx, [](StealingSynCtx& synCtx, size_t count, std::vector<Clock::duration>& latencies, std::atomic<size_t>& remaining) -> Task<void> {
+                co_await hop(synCtx, count, &latencies);
+                if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    remaining.notify_all();
+                }
+            }(synCtx, count, fiberLatencies, remaining));
+        }
+        for (auto value = remaining.load(); value != 0; value = remaining.load()) {
+            remaining.wait(value);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count * fibers));
+    std::vector<Clock::duration> merged;
+    for (auto& fiberLatencies : latencies) {
+        merged.insert(merged.end(), fiberLatencies.begin(), fiberLatencies.end());
+    }
+    set_latency_counters(state, merged);
+}
+BENCHMARK(BM_StealingPostResume)
+    ->ArgNames({"hops", "fibers", "workers"})
+    ->Args({100'000, 1, 1})
+    ->Args({25'000, 4, 4})
+    ->Args({25'000, 16, 4})
+    ->UseRealTime();
+
+/// delay_for accuracy: how late a timer-wheel delay resumes relative to the requested duration
+static void BM_DelayForLateness(benchmark::State& state) {
+    const auto delay = std::chrono::milliseconds(state.range(0));
+    QueueSynCtx synCtx;
+    std::vector<Clock::duration> latencies;
+    for (auto _ : state) {
+        bool done = false;
+        spawn(synCtx, [](QueueSynCtx& synCtx, std::chrono::milliseconds delay, std::vector<Clock::duration>& latencies, bool& done) -> Task<void> {
+            const auto started = Clock::now();
+            co_await delay_for(delay, synCtx);
+            latencies.push_back(Clock::now() - started - delay);
+            done = true;
+        }(synCtx, delay, latencies, done));
+        synCtx.run_until([&done] { return done; });
+    }
+    set_latency_counters(state, latencies);
+}
+BENCHMARK(BM_DelayForLateness)->Arg(1)->Arg(10)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/// delay_for overhead: schedule/fire cost of many concurrent zero-length delays
+static void BM_DelayForOverhead(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    QueueSynCtx synCtx;
+    for (auto _ : state) {
+        size_t remaining = count;
+        for (size_t i = 0; i < count; ++i) {
+            spawn(synCtx, [](QueueSynCtx& synCtx, size_t& remaining) -> Task<void> {
+                co_await delay_for(0ms, synCtx);
+                --remaining;
+            }(synCtx, remaining));
+        }
+        synCtx.run_until([&remaining] { return remaining == 0; });
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_DelayForOverhead)->Arg(10'000)->UseRealTime();
+
+/// Fan-out/fan-in of `range(0)` child tasks, each resumed once through the queue; frames counted per iteration
+static void BM_FanOutFanIn(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    QueueSynCtx synCtx;
+    FramePool::reset_stats();
+    for (auto _ : state) {
+        size_t remaining = count;
+        for (size_t i = 0; i < count; ++i) {
+            spawn(synCtx, [](QueueSynCtx& synCtx, size_t& remaining) -> Task<void> {
+                co_await schedule_on(synCtx);
+                --remaining;
+            }(synCtx, remaining));
+        }
+        synCtx.run_until([&remaining] { return remaining == 0; });
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+    set_frame_counters(state, FramePool::stats());
+}
+BENCHMARK(BM_FanOutFanIn)->Arg(1'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+/// Frame allocation cost of a nested Task chain (pool hits after the first iteration)
+static void BM_TaskChainFrames(benchmark::State& state) {
+    const auto depth = static_cast<size_t>(state.range(0));
+    struct Chain {
+        static Task<size_t> run(size_t level) {
+            if (level == 0) {
+                co_return 0;
+            }
+            co_return 1 + co_await run(level - 1);
+        }
+    };
+    QueueSynCtx synCtx;
+    FramePool::reset_stats();
+    for (auto _ : state) {
+        size_t result = 0;
+        spawn(synCtx, [](size_t depth, size_t& result) -> Task<void> { result = co_await Chain::run(depth); }(depth, result));
+        synCtx.run_all();
+        benchmark::DoNotOptimize(result);
+    }
+    set_frame_counters(state, FramePool::stats());
+}
+BENCHMARK(BM_TaskChainFrames)->Arg(16)->Arg(1024);
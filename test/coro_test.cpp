@@ -7,3 +7,73 @@ TEST_F(CoroTest, Sub) {
     co_await delay_for(std::chrono::milliseconds(200), synCtx);
     Log::Debug("Sub: end");
 }
+
+namespace
+{
+    /// Fire-and-forget coroutine: starts eagerly, frame is destroyed on completion
+    struct Detached {
+        struct promise_type {
+            Detached get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+    Detached delayed_increment(QueueSynCtx& synCtx, std::chrono::milliseconds delay, size_t& counter) {
+        co_await delay_for(delay, synCtx);
+        ++counter;
+    }
+}
+
+TEST_F(CoroTest, ManyConcurrentDelays) {
+    static constexpr size_t Count = 100'000;
+    const auto threadId = std::this_thread::get_id();
+    const auto started = std::chrono::steady_clock::now();
+
+    size_t counter = 0;
+    for (size_t i = 0; i < Count; ++i) {
+        delayed_increment(synCtx, std::chrono::milliseconds(10 + i % 90), counter);
+    }
+    EXPECT_EQ(synCtx.get_timers().size(), Count);
+
+    co_await delay_for(std::chrono::milliseconds(150), synCtx);
+    EXPECT_EQ(counter, Count);
+    EXPECT_EQ(std::this_thread::get_id(), threadId);
+    Log::Info("ManyConcurrentDelays: {} delays in {} ms", Count,
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count());
+}
+
+TEST_F(CoroTest, ShortAwaits) {
+    // Each await completes in its own async time: an idle poll interval per await would add up to hundreds of ms.
+    static constexpr int Count = 20;
+    const auto started = std::chrono::steady_clock::now();
+    for (int i = 0; i < Count; ++i) {
+        co_await delay_for(std::chrono::milliseconds(1), synCtx);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+    EXPECT_LT(elapsed, std::chrono::milliseconds(10 * Count));
+    Log::Info("ShortAwaits: {} awaits in {} us", Count, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+namespace
+{
+    /// Resumed by a post from a foreign thread, joined on resumption: it must not outlive the fixture's context
+    struct ResumeFromThread {
+        QueueSynCtx& synCtx;
+        std::thread poster{};
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) {
+            poster = std::thread([handle, &synCtx = synCtx] { synCtx.post(handle); });
+        }
+        void await_resume() { poster.join(); }
+    };
+}
+
+TEST_F(CoroTest, RemotePostWakes) {
+    const auto threadId = std::this_thread::get_id();
+    co_await ResumeFromThread{synCtx};
+    EXPECT_EQ(std::this_thread::get_id(), threadId);
+}
@@ -0,0 +1,129 @@
+#include "Im/PoolAllocator.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+using Im::PoolAllocator;
+
+namespace
+{
+    constexpr size_t HeaderSize = 16;
+
+    auto address(const void* ptr) {
+        return reinterpret_cast<uintptr_t>(ptr);
+    }
+
+    /// Block size of the class serving `size`: a fresh allocator hands out the blocks of a new slab in address order
+    size_t block_size(size_t size) {
+        PoolAllocator allocator;
+        auto* first = allocator.Allocate(size);
+        auto* second = allocator.Allocate(size);
+        const auto result = address(second) - address(first);
+        allocator.Free(first);
+        allocator.Free(second);
+        return result;
+    }
+}
+
+TEST(PoolAllocator, SizeClassesFitWithBoundedWaste) {
+    size_t previous = 0;
+    for (size_t size = 0; size <= PoolAllocator::MaxPooledSize; size += size < 1024 ? 1 : 61) {
+        const auto block = block_size(size);
+        const auto needed = HeaderSize + std::max<size_t>(size, 1);
+        ASSERT_GE(block, needed) << size;
+        ASSERT_EQ(block % 16, 0u) << size;
+        ASSERT_GE(block, previous) << size; // classes grow with the size
+        // 16-byte steps up to 128, then 4 classes per power of two: under 25% over the request
+        ASSERT_LE(block, needed <= 128 ? needed + 15 : needed + needed / 4) << size;
+        previous = block;
+    }
+    EXPECT_EQ(block_size(PoolAllocator::MaxPooledSize), PoolAllocator::MaxPooledSize + HeaderSize);
+}
+
+TEST(PoolAllocator, BlocksAreAlignedAndDisjoint) {
+    PoolAllocator allocator;
+    struct Block {
+        uint8_t* data;
+        size_t size;
+    };
+    std::vector<Block> blocks;
+    for (size_t size = 1; size <= PoolAllocator::MaxPooledSize; size = size * 3 / 2 + 1) {
+        for (int i = 0; i < 3; ++i) {
+            auto* data = static_cast<uint8_t*>(allocator.Allocate(size));
+            ASSERT_NE(data, nullptr);
+            ASSERT_EQ(address(data) % 16, 0u) << size;
+            std::memset(data, static_cast<int>(blocks.size() & 0xff), size);
+            blocks.push_back({data, size});
+        }
+    }
+    for (size_t index = 0; index < blocks.size(); ++index) {
+        const auto& block = blocks[index];
+        for (size_t offset = 0; offset < block.size; ++offset) {
+            ASSERT_EQ(block.data[offset], index & 0xff) << "block " << index << " overwritten";
+        }
+        allocator.Free(block.data);
+    }
+    EXPECT_EQ(allocator.GetStats().liveBytes, 0u);
+}
+
+TEST(PoolAllocator, FreedBlocksAreReused) {
+    PoolAllocator allocator;
+    auto* first = allocator.Allocate(100);
+    allocator.Free(first);
+    EXPECT_EQ(allocator.Allocate(100), first);
+    auto* sameClass = allocator.Allocate(97); // 113 and 116 byte blocks share the 128 class
+    allocator.Free(sameClass);
+    EXPECT_EQ(allocator.Allocate(110), sameClass);
+    EXPECT_EQ(allocator.GetStats().slabBytes, PoolAllocator::SlabSize);
+}
+
+TEST(PoolAllocator, SlabsServeTheirClassOnly) {
+    PoolAllocator allocator;
+    const auto perSlab = PoolAllocator::SlabSize / 64;
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < perSlab; ++i) {
+        blocks.push_back(allocator.Allocate(48));
+    }
+    EXPECT_EQ(allocator.GetStats().slabBytes, PoolAllocator::SlabSize);
+    blocks.push_back(allocator.Allocate(48)); // the class is exhausted
+    EXPECT_EQ(allocator.GetStats().slabBytes, 2 * PoolAllocator::SlabSize);
+    blocks.push_back(allocator.Allocate(200)); // another class gets its own slab
+    EXPECT_EQ(allocator.GetStats().slabBytes, 3 * PoolAllocator::SlabSize);
+
+    for (auto* block : blocks) {
+        allocator.Free(block);
+    }
+    blocks.clear();
+    for (size_t i = 0; i <= perSlab; ++i) {
+        blocks.push_back(allocator.Allocate(48));
+    }
+    EXPECT_EQ(allocator.GetStats().slabBytes, 3 * PoolAllocator::SlabSize); // kept and reused
+    for (auto* block : blocks) {
+        allocator.Free(block);
+    }
+}
+
+TEST(PoolAllocator, LargeRequestsBypassThePools) {
+    PoolAllocator allocator;
+    auto* pooled = allocator.Allocate(PoolAllocator::MaxPooledSize);
+    EXPECT_EQ(allocator.GetStats().largeAllocations, 0u);
+    auto* large = static_cast<uint8_t*>(allocator.Allocate(PoolAllocator::MaxPooledSize + 1));
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(address(large) % 16, 0u);
+    std::memset(large, 0x5a, PoolAllocator::MaxPooledSize + 1);
+
+    const auto& stats = allocator.GetStats();
+    EXPECT_EQ(stats.largeAllocations, 1u);
+    EXPECT_EQ(stats.largeBytes, PoolAllocator::MaxPooledSize + 1);
+    EXPECT_EQ(stats.liveBytes, 2 * PoolAllocator::MaxPooledSize + 1);
+    allocator.Free(large);
+    allocator.Free(pooled);
+    allocator.Free(nullptr);
+    EXPECT_EQ(stats.largeBytes, 0u);
+    EXPECT_EQ(stats.liveBytes, 0u);
+    EXPECT_EQ(stats.peakLiveBytes, 2 * PoolAllocator::MaxPooledSize + 1);
+    EXPECT_EQ(stats.allocations, 2u);
+    EXPECT_EQ(stats.frees, 2u);
+}
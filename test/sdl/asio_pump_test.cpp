@@ -0,0 +1,111 @@
+#include "Sdl/Loop/AsioPump.h"
+#include "Sdl/Loop/Sdl3Runner.h"
+#include <SDL3/SDL_events.h>
+#include <SDL3/SDL_init.h>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using Sdl::Loop::AsioPump;
+using Sdl::Loop::Sdl3Runner;
+using namespace std::chrono_literals;
+
+TEST(AsioPump, PollStopsAtDeadline) {
+    boost::asio::io_context context;
+    AsioPump pump{context};
+    int ran = 0;
+    for (int i = 0; i < 100; ++i) {
+        boost::asio::post(context, [&ran] {
+            std::this_thread::sleep_for(200us);
+            ++ran;
+        });
+    }
+
+    EXPECT_TRUE(pump.Poll(AsioPump::Clock::now() + 2ms)); // backlog left for the next frames
+    EXPECT_GE(ran, 1);
+    EXPECT_LT(ran, 100);
+    EXPECT_TRUE(pump.HasPendingWork());
+
+    while (pump.Poll(AsioPump::Clock::now() + 2ms)) {}
+    EXPECT_EQ(ran, 100);
+}
+
+TEST(AsioPump, RestartsAfterRunningOutOfWork) {
+    boost::asio::io_context context;
+    AsioPump pump{context};
+    EXPECT_FALSE(pump.Poll(AsioPump::Clock::now() + 1s));
+    EXPECT_FALSE(pump.HasPendingWork()); // stopped for lack of work
+
+    int ran = 0;
+    boost::asio::post(pump.GetExecutor(), [&ran] { ++ran; });
+    EXPECT_FALSE(pump.Poll(AsioPump::Clock::now() + 1s));
+    EXPECT_EQ(ran, 1);
+}
+
+TEST(AsioPump, PendingTimerBoundsIdleWait) {
+    boost::asio::io_context context;
+    AsioPump pump{context};
+    boost::asio::steady_timer timer{context, 1h};
+    bool cancelled = false;
+    timer.async_wait([&cancelled](const boost::system::error_code& error) { cancelled = error == boost::asio::error::operation_aborted; });
+
+    EXPECT_FALSE(pump.Poll(AsioPump::Clock::now() + 1s)); // nothing ready
+    EXPECT_TRUE(pump.HasPendingWork());
+    timer.cancel();
+    EXPECT_FALSE(pump.Poll(AsioPump::Clock::now() + 1s));
+    EXPECT_TRUE(cancelled);
+    EXPECT_FALSE(pump.HasPendingWork());
+}
+
+TEST(Sdl3Runner, WakeCoalesces) {
+    ASSERT_TRUE(SDL_Init(SDL_INIT_EVENTS));
+    Sdl3Runner::RegisterWakeEvent();
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    const auto wakeFromThreads = [] {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([] {
+                for (int i = 0; i < 1'000; ++i) {
+                    Sdl3Runner::Wake();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    };
+    const auto popEvents = [] {
+        std::vector<SDL_Event> events;
+        SDL_Event event;
+        while (SDL_PollEvent(&event)) {
+            events.push_back(event);
+        }
+        return events;
+    };
+
+    for (int round = 0; round < 2; ++round) {
+        wakeFromThreads();
+        const auto events = popEvents();
+        ASSERT_EQ(events.size(), 1u) << "round " << round;
+        EXPECT_TRUE(Sdl3Runner::ConsumeWakeEvent(events[0])); // re-arms the next Wake
+    }
+    // re-armed by consuming, not by popping: wakes between the two are covered by the popped event
+    wakeFromThreads();
+    const auto popped = popEvents();
+    ASSERT_EQ(popped.size(), 1u);
+    Sdl3Runner::Wake();
+    EXPECT_TRUE(popEvents().empty());
+    EXPECT_TRUE(Sdl3Runner::ConsumeWakeEvent(popped[0]));
+    Sdl3Runner::Wake();
+    const auto events = popEvents();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_TRUE(Sdl3Runner::ConsumeWakeEvent(events[0]));
+
+    SDL_Event other{};
+    other.type = SDL_EVENT_KEY_DOWN;
+    EXPECT_FALSE(Sdl3Runner::ConsumeWakeEvent(other));
+    SDL_Quit();
+}
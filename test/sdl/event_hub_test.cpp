@@ -0,0 +1,113 @@
+#include "Sdl/Loop/EventHub.h"
+#include <gtest/gtest.h>
+#include <optional>
+
+using Sdl::Loop::EventHub;
+using Sdl::Loop::EventSubscription;
+
+namespace
+{
+    SDL_Event make_event(Uint32 type, Uint64 timestamp) {
+        SDL_Event event{};
+        event.type = type;
+        event.common.timestamp = timestamp;
+        return event;
+    }
+
+    std::optional<Uint64> pop_timestamp(EventSubscription& subscription) {
+        SDL_Event event;
+        if (!subscription.TryPop(event)) {
+            return std::nullopt;
+        }
+        return event.common.timestamp;
+    }
+}
+
+TEST(EventSubscription, QueuesInOrder) {
+    EventHub hub;
+    EventSubscription subscription{hub, {}};
+    for (Uint64 i = 1; i <= 3; ++i) {
+        hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, i));
+    }
+    EXPECT_EQ(subscription.GetCount(), 3u);
+    EXPECT_EQ(pop_timestamp(subscription), 1u);
+    EXPECT_EQ(pop_timestamp(subscription), 2u);
+    EXPECT_EQ(pop_timestamp(subscription), 3u);
+    EXPECT_EQ(pop_timestamp(subscription), std::nullopt);
+    EXPECT_TRUE(subscription.IsEmpty());
+}
+
+TEST(EventSubscription, FullRingDropsOldest) {
+    EventHub hub;
+    EventSubscription subscription{hub, {}, 3}; // rounded up to 4
+    for (Uint64 i = 1; i <= 6; ++i) {
+        hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, i));
+    }
+    EXPECT_EQ(subscription.GetCount(), 4u);
+    EXPECT_EQ(subscription.GetDropped(), 2u);
+    for (Uint64 i = 3; i <= 6; ++i) {
+        EXPECT_EQ(pop_timestamp(subscription), i);
+    }
+
+    // wrapped around: still in order after more pushes and pops
+    Uint64 expected = 7;
+    for (Uint64 i = 7; i <= 12; ++i) {
+        hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, i));
+        if (i % 2 == 0) {
+            EXPECT_EQ(pop_timestamp(subscription), expected++);
+        }
+    }
+    for (; expected <= 12; ++expected) {
+        EXPECT_EQ(pop_timestamp(subscription), expected);
+    }
+    EXPECT_TRUE(subscription.IsEmpty());
+    EXPECT_EQ(subscription.GetDropped(), 2u);
+}
+
+TEST(EventSubscription, ClearEmpties) {
+    EventHub hub;
+    EventSubscription subscription{hub, {}, 4};
+    for (Uint64 i = 1; i <= 3; ++i) {
+        hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, i));
+    }
+    subscription.Clear();
+    EXPECT_TRUE(subscription.IsEmpty());
+    EXPECT_EQ(pop_timestamp(subscription), std::nullopt);
+    hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 4));
+    EXPECT_EQ(pop_timestamp(subscription), 4u);
+}
+
+TEST(EventSubscription, FiltersByType) {
+    EventHub hub;
+    EventSubscription keys{hub, EventSubscription::Filter::Type(SDL_EVENT_KEY_DOWN)};
+    EventSubscription mouse{hub, {.firstType = SDL_EVENT_MOUSE_MOTION, .lastType = SDL_EVENT_MOUSE_BUTTON_UP, .window = {}}};
+    hub.Dispatch(make_event(SDL_EVENT_QUIT, 1));
+    hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 2));
+    hub.Dispatch(make_event(SDL_EVENT_KEY_UP, 3));
+    hub.Dispatch(make_event(SDL_EVENT_MOUSE_BUTTON_DOWN, 4));
+    hub.Dispatch(make_event(SDL_EVENT_MOUSE_MOTION, 5));
+
+    EXPECT_EQ(keys.GetCount(), 1u);
+    EXPECT_EQ(pop_timestamp(keys), 2u);
+    EXPECT_EQ(mouse.GetCount(), 2u);
+    EXPECT_EQ(pop_timestamp(mouse), 4u);
+    EXPECT_EQ(pop_timestamp(mouse), 5u);
+}
+
+TEST(EventSubscription, NotifiesOnPushAndUnsubscribes) {
+    EventHub hub;
+    int notified = 0;
+    {
+        EventSubscription subscription{hub, {}};
+        EXPECT_EQ(hub.GetSubscriptionCount(), 1u);
+        subscription.SetNotify([](void* context) { ++*static_cast<int*>(context); }, &notified);
+        hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 1));
+        hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 2));
+        EXPECT_EQ(notified, 2);
+        subscription.SetNotify(nullptr, nullptr);
+        hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 3));
+        EXPECT_EQ(notified, 2);
+    }
+    EXPECT_EQ(hub.GetSubscriptionCount(), 0u);
+    hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 4)); // nothing subscribed
+}
@@ -0,0 +1,176 @@
+#include "Sdl/Loop/EventStream.h"
+#include <boost/asio/bind_cancellation_slot.hpp>
+#include <boost/asio/bind_executor.hpp>
+#include <boost/asio/cancellation_signal.hpp>
+#include <boost/asio/io_context.hpp>
+#include <gtest/gtest.h>
+#include <optional>
+
+using Sdl::Loop::EventHub;
+using Sdl::Loop::EventStream;
+using Sdl::Loop::EventSubscription;
+
+namespace
+{
+    struct Result {
+        int calls = 0;
+        boost::system::error_code error;
+        SDL_Event event{};
+    };
+
+    SDL_Event make_event(Uint32 type, Uint64 timestamp) {
+        SDL_Event event{};
+        event.type = type;
+        event.common.timestamp = timestamp;
+        return event;
+    }
+
+    /// Completion handler running on the context (a plain lambda would complete on the system executor)
+    auto store_in(boost::asio::io_context& context, Result& result) {
+        return boost::asio::bind_executor(context, [&result](boost::system::error_code error, SDL_Event event) {
+            ++result.calls;
+            result.error = error;
+            result.event = event;
+        });
+    }
+}
+
+TEST(EventStream, CompletesWithQueuedEvent) {
+    boost::asio::io_context context;
+    EventHub hub;
+    EventStream stream{hub};
+    hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 1));
+
+    Result result;
+    stream.Next(store_in(context, result));
+    EXPECT_EQ(result.calls, 0); // never inline
+    context.poll();
+    EXPECT_EQ(result.calls, 1);
+    EXPECT_FALSE(result.error);
+    EXPECT_EQ(result.event.common.timestamp, 1u);
+}
+
+TEST(EventStream, WaitsForDispatch) {
+    boost::asio::io_context context;
+    EventHub hub;
+    EventStream stream{hub};
+
+    Result result;
+    stream.Next(store_in(context, result));
+    context.poll();
+    context.restart();
+    EXPECT_EQ(result.calls, 0);
+
+    hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 2));
+    hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 3)); // queued for the next wait
+    context.poll();
+    context.restart();
+    EXPECT_EQ(result.calls, 1);
+    EXPECT_EQ(result.event.common.timestamp, 2u);
+    EXPECT_EQ(stream.GetSubscription().GetCount(), 1u);
+
+    stream.Next(store_in(context, result));
+    context.poll();
+    EXPECT_EQ(result.calls, 2);
+    EXPECT_EQ(result.event.common.timestamp, 3u);
+}
+
+TEST(EventStream, NextTypeSkipsOtherEvents) {
+    boost::asio::io_context context;
+    EventHub hub;
+    EventStream stream{hub};
+    hub.Dispatch(make_event(SDL_EVENT_QUIT, 1));
+    hub.Dispatch(make_event(SDL_EVENT_KEY_UP, 2));
+
+    Result result;
+    stream.Next(SDL_EVENT_KEY_DOWN, store_in(context, result));
+    hub.Dispatch(make_event(SDL_EVENT_MOUSE_MOTION, 3));
+    context.poll();
+    context.restart();
+    EXPECT_EQ(result.calls, 0);
+
+    hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 4));
+    context.poll();
+    EXPECT_EQ(result.calls, 1);
+    EXPECT_EQ(result.event.common.timestamp, 4u);
+    EXPECT_TRUE(stream.GetSubscription().IsEmpty());
+}
+
+TEST(EventStream, SecondWaitIsRejected) {
+    boost::asio::io_context context;
+    EventHub hub;
+    EventStream stream{hub};
+
+    Result first;
+    Result second;
+    stream.Next(store_in(context, first));
+    stream.Next(store_in(context, second));
+    context.poll();
+    context.restart();
+    EXPECT_EQ(first.calls, 0);
+    EXPECT_EQ(second.calls, 1);
+    EXPECT_EQ(second.error, boost::asio::error::in_progress);
+
+    hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 1));
+    context.poll();
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_FALSE(first.error);
+}
+
+TEST(EventStream, CancellationAbortsTheWait) {
+    boost::asio::io_context context;
+    EventHub hub;
+    EventStream stream{hub};
+    boost::asio::cancellation_signal cancel;
+
+    Result result;
+    stream.Next(boost::asio::bind_cancellation_slot(cancel.slot(), store_in(context, result)));
+    cancel.emit(boost::asio::cancellation_type::terminal);
+    context.poll();
+    context.restart();
+    EXPECT_EQ(result.calls, 1);
+    EXPECT_EQ(result.error, boost::asio::error::operation_aborted);
+
+    // events keep being queued and the stream can wait again
+    hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 5));
+    cancel.emit(boost::asio::cancellation_type::terminal); // the slot was cleared: no effect
+    stream.Next(store_in(context, result));
+    context.poll();
+    EXPECT_EQ(result.calls, 2);
+    EXPECT_FALSE(result.error);
+    EXPECT_EQ(result.event.common.timestamp, 5u);
+}
+
+TEST(EventStream, DestructionAbortsTheWait) {
+    boost::asio::io_context context;
+    EventHub hub;
+    std::optional<EventStream> stream{std::in_place, hub};
+
+    Result result;
+    stream->Next(store_in(context, result));
+    stream.reset();
+    EXPECT_EQ(hub.GetSubscriptionCount(), 0u);
+    hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, 1));
+    context.poll();
+    EXPECT_EQ(result.calls, 1);
+    EXPECT_EQ(result.error, boost::asio::error::operation_aborted);
+}
+
+TEST(EventStream, RingOverflowDropsOldest) {
+    boost::asio::io_context context;
+    EventHub hub;
+    EventStream stream{hub, EventSubscription::Filter::Type(SDL_EVENT_KEY_DOWN), 2};
+    for (Uint64 i = 1; i <= 5; ++i) {
+        hub.Dispatch(make_event(SDL_EVENT_KEY_DOWN, i));
+    }
+    EXPECT_EQ(stream.GetSubscription().GetDropped(), 3u);
+
+    Result result;
+    for (Uint64 expected = 4; expected <= 5; ++expected) {
+        stream.Next(store_in(context, result));
+        context.poll();
+        context.restart();
+        EXPECT_EQ(result.event.common.timestamp, expected);
+    }
+    EXPECT_EQ(result.calls, 2);
+}
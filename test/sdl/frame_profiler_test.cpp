@@ -0,0 +1,41 @@
+#include "Sdl/Stats/FrameProfiler.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+
+using Sdl::Stats::FrameProfiler;
+
+namespace
+{
+    std::string read_file(const std::filesystem::path& path) {
+        std::ifstream in{path};
+        std::stringstream text;
+        text << in.rdbuf();
+        return text.str();
+    }
+}
+
+TEST(FrameProfiler, RecordsAreCapped) {
+    FrameProfiler profiler{2};
+    for (uint64_t frame = 0; frame < 5; ++frame) {
+        profiler.BeginFrame(frame);
+        profiler.EndFrame();
+    }
+    EXPECT_EQ(profiler.GetRecords().size(), 2u);
+    EXPECT_EQ(profiler.GetRecords().capacity(), 2u); // no reallocation inside the measured frames
+    EXPECT_EQ(profiler.GetDroppedFrames(), 3u);
+}
+
+TEST(FrameProfiler, ReportEscapesName) {
+    FrameProfiler profiler{1};
+    profiler.BeginFrame(0);
+    profiler.EndFrame();
+
+    const auto path = std::filesystem::temp_directory_path() / "frame_profiler_test.json";
+    ASSERT_TRUE(profiler.WriteReport(path.string(), "say \"hi\" C:\\tmp\n"));
+    const auto report = read_file(path);
+    std::filesystem::remove(path);
+    EXPECT_NE(report.find(R"("name": "say \"hi\" C:\\tmp\n",)"), std::string::npos) << report;
+    EXPECT_NE(report.find(R"("dropped_frames": 0,)"), std::string::npos) << report;
+}
@@ -0,0 +1,104 @@
+#include "Sdl/Stats/FrameStats.h"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using Sdl::Stats::FrameStats;
+
+namespace
+{
+    /// Upper bound of a histogram bucket relative to its lower bound
+    const float BucketRatio = std::exp2(1.0f / FrameStats::BucketsPerOctave);
+
+    float exact_percentile(std::vector<float> window, float fraction) {
+        std::ranges::sort(window);
+        const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<float>(window.size())));
+        return window[std::clamp<size_t>(rank, 1, window.size()) - 1];
+    }
+}
+
+TEST(FrameStats, EmptyIsZero) {
+    FrameStats stats;
+    EXPECT_EQ(stats.GetSampleCount(), 0u);
+    EXPECT_EQ(stats.GetAverageSeconds(), 0.0f);
+    EXPECT_EQ(stats.GetAverageFps(), 0.0f);
+    EXPECT_EQ(stats.GetJitterSeconds(), 0.0f);
+    EXPECT_EQ(stats.GetPercentileSeconds(0.99f), 0.0f);
+    EXPECT_EQ(stats.GetMaxSeconds(), 0.0f);
+}
+
+TEST(FrameStats, AverageAndJitter) {
+    FrameStats stats{4};
+    for (auto seconds : {0.010f, 0.020f, 0.010f, 0.020f}) {
+        stats.AddFrame(seconds);
+    }
+    EXPECT_NEAR(stats.GetAverageSeconds(), 0.015f, 1e-6f);
+    EXPECT_NEAR(stats.GetAverageFps(), 1.0f / 0.015f, 1e-2f);
+    EXPECT_NEAR(stats.GetJitterSeconds(), 0.005f, 1e-6f);
+
+    stats.AddFrame(0.0f); // ignored
+    stats.AddFrame(-1.0f);
+    EXPECT_EQ(stats.GetTotalFrameCount(), 4u);
+}
+
+TEST(FrameStats, PercentilesWithinBucketResolution) {
+    FrameStats stats{100};
+    for (int i = 0; i < 99; ++i) {
+        stats.AddFrame(0.010f);
+    }
+    stats.AddFrame(0.050f);
+
+    const auto p50 = stats.GetPercentileSeconds(0.50f);
+    EXPECT_GE(p50, 0.010f);
+    EXPECT_LE(p50, 0.010f * BucketRatio);
+    EXPECT_LE(stats.GetPercentileSeconds(0.99f), 0.010f * BucketRatio);
+    EXPECT_EQ(stats.GetPercentileSeconds(1.0f), 0.050f); // clamped to the exact max
+}
+
+TEST(FrameStats, SlidingWindowEvicts) {
+    FrameStats stats{4, 1.0f / 60.0f};
+    stats.AddFrame(0.100f);
+    EXPECT_EQ(stats.GetMaxSeconds(), 0.100f);
+    EXPECT_EQ(stats.GetOverBudgetCount(), 1u);
+
+    for (int i = 0; i < 4; ++i) {
+        stats.AddFrame(0.010f);
+    }
+    EXPECT_EQ(stats.GetSampleCount(), 4u);
+    EXPECT_EQ(stats.GetMaxSeconds(), 0.010f);
+    EXPECT_NEAR(stats.GetAverageSeconds(), 0.010f, 1e-6f);
+    EXPECT_EQ(stats.GetOverBudgetCount(), 0u);
+    EXPECT_EQ(stats.GetTotalOverBudgetCount(), 1u);
+    EXPECT_EQ(stats.GetTotalFrameCount(), 5u);
+
+    stats.Reset();
+    EXPECT_EQ(stats.GetSampleCount(), 0u);
+    EXPECT_EQ(stats.GetMaxSeconds(), 0.0f);
+    EXPECT_EQ(stats.GetTotalOverBudgetCount(), 0u);
+}
+
+TEST(FrameStats, MatchesExactWindowStats) {
+    static constexpr size_t Capacity = 64;
+    FrameStats stats{Capacity};
+    std::vector<float> history;
+    std::mt19937 random{42};
+    std::lognormal_distribution<float> frameTime{std::log(0.016f), 0.5f};
+
+    for (int i = 0; i < 1'000; ++i) {
+        const auto seconds = frameTime(random);
+        stats.AddFrame(seconds);
+        history.push_back(seconds);
+
+        const auto windowStart = history.size() > Capacity ? history.end() - Capacity : history.begin();
+        const std::vector<float> window(windowStart, history.end());
+        ASSERT_EQ(stats.GetMaxSeconds(), *std::ranges::max_element(window)) << "at " << i;
+        for (auto fraction : {0.5f, 0.95f, 0.99f}) {
+            const auto exact = exact_percentile(window, fraction);
+            const auto estimate = stats.GetPercentileSeconds(fraction);
+            ASSERT_GE(estimate, exact) << "p" << fraction << " at " << i;
+            ASSERT_LE(estimate, exact * BucketRatio * 1.0001f) << "p" << fraction << " at " << i;
+        }
+    }
+}
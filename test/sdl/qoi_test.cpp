@@ -0,0 +1,152 @@
+#include "Sdl/Loop/FrameCapture.h"
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using Sdl::Loop::FrameCapture;
+
+namespace
+{
+    struct Image {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint8_t channels = 0;
+        std::vector<uint8_t> rgba;
+    };
+
+    uint32_t read_big_endian(const uint8_t* bytes) {
+        return uint32_t{bytes[0]} << 24 | uint32_t{bytes[1]} << 16 | uint32_t{bytes[2]} << 8 | bytes[3];
+    }
+
+    /// Straightforward decoder following the QOI specification
+    Image decode_qoi(const std::vector<uint8_t>& data) {
+        Image image;
+        if (data.size() < 14 + 8 || data[0] != 'q' || data[1] != 'o' || data[2] != 'i' || data[3] != 'f') {
+            ADD_FAILURE() << "not a QOI image";
+            return image;
+        }
+        image.width = read_big_endian(&data[4]);
+        image.height = read_big_endian(&data[8]);
+        image.channels = data[12];
+
+        std::array<std::array<uint8_t, 4>, 64> index{};
+        std::array<uint8_t, 4> pixel{0, 0, 0, 255};
+        size_t position = 14;
+        const auto end = data.size() - 8;
+        int run = 0;
+        for (size_t count = size_t{image.width} * image.height; count > 0; --count) {
+            if (run > 0) {
+                --run;
+            } else if (position < end) {
+                const auto op = data[position++];
+                if (op == 0xfe) {
+                    pixel = {data[position], data[position + 1], data[position + 2], pixel[3]};
+                    position += 3;
+                } else if (op == 0xff) {
+                    pixel = {data[position], data[position + 1], data[position + 2], data[position + 3]};
+                    position += 4;
+                } else if ((op & 0xc0) == 0x00) {
+                    pixel = index[op];
+                } else if ((op & 0xc0) == 0x40) {
+                    pixel[0] = static_cast<uint8_t>(pixel[0] + ((op >> 4) & 3) - 2);
+                    pixel[1] = static_cast<uint8_t>(pixel[1] + ((op >> 2) & 3) - 2);
+                    pixel[2] = static_cast<uint8_t>(pixel[2] + (op & 3) - 2);
+                } else if ((op & 0xc0) == 0x80) {
+                    const auto next = data[position++];
+                    const auto dg = (op & 0x3f) - 32;
+                    pixel[0] = static_cast<uint8_t>(pixel[0] + dg - 8 + ((next >> 4) & 0x0f));
+                    pixel[1] = static_cast<uint8_t>(pixel[1] + dg);
+                    pixel[2] = static_cast<uint8_t>(pixel[2] + dg - 8 + (next & 0x0f));
+                } else {
+                    run = op & 0x3f;
+                }
+                index[(pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) % 64] = pixel;
+            }
+            image.rgba.insert(image.rgba.end(), pixel.begin(), pixel.end());
+        }
+        EXPECT_EQ(position, end) << "trailing data";
+        EXPECT_EQ(std::vector<uint8_t>(data.end() - 8, data.end()), (std::vector<uint8_t>{0, 0, 0, 0, 0, 0, 0, 1}));
+        return image;
+    }
+
+    std::vector<uint8_t> encode(std::vector<uint8_t>& rgba, int width, int height, uint8_t channels) {
+        Sdl::Surface surface{SDL_CreateSurfaceFrom(width, height, SDL_PIXELFORMAT_RGBA32, rgba.data(), width * 4)};
+        EXPECT_TRUE(surface);
+        std::vector<uint8_t> out;
+        if (surface) {
+            FrameCapture::EncodeQoi(*surface, out, channels);
+        }
+        return out;
+    }
+
+    std::vector<uint8_t> opaque(std::vector<uint8_t> rgba) {
+        for (size_t i = 3; i < rgba.size(); i += 4) {
+            rgba[i] = 255;
+        }
+        return rgba;
+    }
+}
+
+TEST(Qoi, BlackPixelsStayOpaque) {
+    // black after another color: its index slot is still zeroed (transparent black) in the decoder
+    std::vector<uint8_t> rgba{
+        200, 10, 10, 255, 0, 0, 0, 255, 0, 0, 0, 255,
+        0, 0, 0, 255, 10, 200, 10, 255, 0, 0, 0, 255,
+    };
+    const auto image = decode_qoi(encode(rgba, 3, 2, 3));
+    EXPECT_EQ(image.width, 3u);
+    EXPECT_EQ(image.height, 2u);
+    EXPECT_EQ(image.channels, 3);
+    EXPECT_EQ(image.rgba, rgba);
+}
+
+TEST(Qoi, OpaqueIgnoresAlpha) {
+    std::vector<uint8_t> rgba{0, 0, 0, 0, 1, 2, 3, 17, 1, 2, 3, 18, 0, 0, 0, 0};
+    const auto image = decode_qoi(encode(rgba, 2, 2, 3));
+    EXPECT_EQ(image.rgba, opaque(rgba));
+}
+
+TEST(Qoi, AlphaChangesRoundTrip) {
+    std::vector<uint8_t> rgba{
+        0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 128,
+        5, 6, 7, 128, 5, 6, 7, 255, 6, 6, 7, 255, 5, 6, 7, 128,
+    };
+    const auto image = decode_qoi(encode(rgba, 4, 2, 4));
+    EXPECT_EQ(image.channels, 4);
+    EXPECT_EQ(image.rgba, rgba);
+}
+
+TEST(Qoi, RandomImagesRoundTrip) {
+    std::mt19937 random{3};
+    for (const auto channels : {uint8_t{3}, uint8_t{4}}) {
+        constexpr int Width = 67;
+        constexpr int Height = 31;
+        std::vector<uint8_t> rgba(Width * Height * 4);
+        // a few colors and alphas with runs and small steps, so every op is used
+        std::uniform_int_distribution<int> choice{0, 7};
+        std::array<uint8_t, 4> pixel{};
+        for (size_t i = 0; i < rgba.size(); i += 4) {
+            switch (choice(random)) {
+                case 0: pixel = {0, 0, 0, 255}; break;
+                case 1: pixel[3] = static_cast<uint8_t>(choice(random) * 32); break;
+                case 2: pixel[0] = static_cast<uint8_t>(pixel[0] + choice(random) - 4); break;
+                case 3: pixel[1] = static_cast<uint8_t>(pixel[1] + choice(random) * 5); break;
+                case 4: pixel = {static_cast<uint8_t>(random()), static_cast<uint8_t>(random()), static_cast<uint8_t>(random()), pixel[3]}; break;
+                default: break; // repeat
+            }
+            std::copy(pixel.begin(), pixel.end(), rgba.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        const auto image = decode_qoi(encode(rgba, Width, Height, channels));
+        EXPECT_EQ(image.rgba, channels == 4 ? rgba : opaque(rgba)) << int{channels};
+    }
+}
+
+TEST(Qoi, LongRunsAreSplit) {
+    std::vector<uint8_t> rgba(200 * 4, 0);
+    const auto data = encode(rgba, 200, 1, 4);
+    const auto image = decode_qoi(data);
+    EXPECT_EQ(image.rgba, rgba);
+    EXPECT_LT(data.size(), 14u + 8u + 10u);
+}
@@ -0,0 +1,79 @@
+#include "Sdl/Render/SkylinePacker.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using Sdl::Render::SkylinePacker;
+
+namespace
+{
+    bool overlap(const SkylinePacker::Rect& a, const SkylinePacker::Rect& b) {
+        return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+}
+
+TEST(SkylinePacker, RejectsInvalidSizes) {
+    SkylinePacker packer{64, 32};
+    EXPECT_FALSE(packer.Pack(0, 8));
+    EXPECT_FALSE(packer.Pack(8, -1));
+    EXPECT_FALSE(packer.Pack(65, 8));
+    EXPECT_FALSE(packer.Pack(8, 33));
+    EXPECT_EQ(packer.GetUsedArea(), 0);
+}
+
+TEST(SkylinePacker, FillsPageWithTiles) {
+    SkylinePacker packer{64, 64};
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_TRUE(packer.Pack(16, 16)) << i;
+    }
+    EXPECT_FLOAT_EQ(packer.GetOccupancy(), 1.0f);
+    EXPECT_FALSE(packer.Pack(1, 1));
+
+    packer.Reset();
+    EXPECT_EQ(packer.GetUsedArea(), 0);
+    const auto rect = packer.Pack(64, 64);
+    ASSERT_TRUE(rect);
+    EXPECT_EQ(rect->x, 0);
+    EXPECT_EQ(rect->y, 0);
+}
+
+TEST(SkylinePacker, PlacesLowestFirst) {
+    SkylinePacker packer{64, 64};
+    const auto tall = packer.Pack(16, 32);
+    const auto wide = packer.Pack(48, 8);
+    const auto next = packer.Pack(16, 8);
+    ASSERT_TRUE(tall && wide && next);
+    EXPECT_EQ(wide->x, 16);
+    EXPECT_EQ(wide->y, 0);
+    EXPECT_EQ(next->y, 8); // on top of the wide one, not of the tall one
+    EXPECT_GE(next->x, 16);
+}
+
+TEST(SkylinePacker, RandomRectsDontOverlap) {
+    SkylinePacker packer{256, 256};
+    std::mt19937 random{7};
+    std::uniform_int_distribution<int> size{1, 40};
+    std::vector<SkylinePacker::Rect> packed;
+    int64_t area = 0;
+    for (int i = 0; i < 500; ++i) {
+        const auto w = size(random);
+        const auto h = size(random);
+        const auto rect = packer.Pack(w, h);
+        if (!rect) {
+            continue;
+        }
+        EXPECT_EQ(rect->w, w);
+        EXPECT_EQ(rect->h, h);
+        ASSERT_GE(rect->x, 0);
+        ASSERT_GE(rect->y, 0);
+        ASSERT_LE(rect->x + rect->w, 256);
+        ASSERT_LE(rect->y + rect->h, 256);
+        for (const auto& other : packed) {
+            ASSERT_FALSE(overlap(*rect, other)) << i;
+        }
+        packed.push_back(*rect);
+        area += int64_t{w} * h;
+    }
+    EXPECT_EQ(packer.GetUsedArea(), area);
+    EXPECT_GT(packer.GetOccupancy(), 0.6f);
+}
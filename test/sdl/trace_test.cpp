@@ -0,0 +1,59 @@
+#include "Sdl/Stats/Trace.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+
+using Sdl::Stats::Trace;
+
+namespace
+{
+    std::string write_trace() {
+        const auto path = std::filesystem::temp_directory_path() / "trace_test.json";
+        EXPECT_TRUE(Trace::WriteJson(path.string()));
+        std::ifstream in{path};
+        std::stringstream text;
+        text << in.rdbuf();
+        std::filesystem::remove(path);
+        return text.str();
+    }
+
+    size_t count_of(const std::string& text, const std::string& needle) {
+        size_t count = 0;
+        for (auto position = text.find(needle); position != std::string::npos; position = text.find(needle, position + 1)) {
+            ++count;
+        }
+        return count;
+    }
+}
+
+TEST(Trace, RecordsOnlyRegisteredThreads) {
+    Trace::Start(16);
+    std::thread([] {
+        Trace::Counter("unregistered", 1.0); // no storage: dropped, not allocated
+        Trace::SetThreadName("trace_test worker");
+        Trace::Counter("registered", 2.0); // registered during the session: recorded from now on
+    }).join();
+    Trace::Stop();
+
+    const auto trace = write_trace();
+    EXPECT_EQ(count_of(trace, "\"unregistered\""), 0u) << trace;
+    EXPECT_EQ(count_of(trace, "\"registered\""), 1u) << trace;
+    EXPECT_EQ(count_of(trace, "\"trace_test worker\""), 1u) << trace;
+}
+
+TEST(Trace, NewSessionDiscardsEventsAndCapsCapacity) {
+    Trace::SetThreadName("trace_test main");
+    Trace::Start(4);
+    Trace::Counter("first", 1.0);
+    Trace::Start(4);
+    for (int i = 0; i < 6; ++i) {
+        Trace::Counter("second", i);
+    }
+    Trace::Stop();
+
+    const auto trace = write_trace();
+    EXPECT_EQ(count_of(trace, "\"first\""), 0u) << trace;
+    EXPECT_EQ(count_of(trace, "\"second\""), 4u) << trace;
+}
@@ -0,0 +1,169 @@
+#include "CoroStealing.h"
+#include "CoroTask.h"
+#include "CoroTest.h"
+#include "CoroWhen.h"
+#include <algorithm>
+#include <array>
+
+using namespace std::chrono_literals;
+
+using StealingCoroTest = BasicCoroTest<StealingSynCtx>;
+
+TEST_F(StealingCoroTest, DelayResumesOnWorker) {
+    EXPECT_TRUE(synCtx.current_worker().has_value());
+    co_await delay_for(5ms, synCtx);
+    EXPECT_TRUE(synCtx.current_worker().has_value());
+}
+
+TEST_F(StealingCoroTest, WhenAllAcrossWorkers) {
+    auto child = [](StealingSynCtx& synCtx, std::chrono::milliseconds delay) -> Task<size_t> {
+        co_await delay_for(delay, synCtx);
+        co_return synCtx.current_worker().value_or(SIZE_MAX);
+    };
+    auto [a, b, c] = co_await when_all(child(synCtx, 3ms), child(synCtx, 1ms), child(synCtx, 2ms));
+    EXPECT_LT(a, synCtx.worker_count());
+    EXPECT_LT(b, synCtx.worker_count());
+    EXPECT_LT(c, synCtx.worker_count());
+}
+
+TEST(StealingSynCtx, FanOutCompletes) {
+    static constexpr size_t Count = 10'000;
+    std::atomic<size_t> remaining{Count}; // outlives the context: the last leaf notifies after the wait saw zero
+    {
+        StealingSynCtx synCtx{4};
+        auto leaf = [](StealingSynCtx& synCtx, std::atomic<size_t>& remaining) -> Task<void> {
+            co_await schedule_on(synCtx);
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                remaining.notify_all();
+            }
+        };
+        // fan out from a worker so children land in its deque and get stolen by the others
+        spawn(synCtx, [](StealingSynCtx& synCtx, std::atomic<size_t>& remaining, auto leaf) -> Task<void> {
+            for (size_t i = 0; i < Count; ++i) {
+                spawn(synCtx, leaf(synCtx, remaining));
+            }
+            co_return;
+        }(synCtx, remaining, leaf));
+
+        for (auto value = remaining.load(); value != 0; value = remaining.load()) {
+            remaining.wait(value);
+        }
+        Log::Info("FanOutCompletes: steals={}", synCtx.steal_count());
+    }
+    EXPECT_EQ(remaining.load(), 0u);
+}
+
+TEST(WorkStealingDeque, OwnerLifoThiefFifo) {
+    WorkStealingDeque<int> deque{2};
+    for (int i = 0; i < 5; ++i) {
+        deque.push(i); // grows past the initial capacity
+    }
+    int value = -1;
+    EXPECT_TRUE(deque.steal(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, 4);
+    EXPECT_EQ(deque.size(), 3u);
+}
+
+TEST(WorkStealingDeque, ConcurrentStealsTakeEachItemOnce) {
+    static constexpr int Count = 20'000;
+    WorkStealingDeque<int> deque;
+    std::vector<std::atomic<int>> seen(Count);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&] {
+            int value = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                if (deque.steal(value)) {
+                    seen[value].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    int value = 0;
+    for (int i = 0; i < Count; ++i) {
+        deque.push(i);
+        if (i % 3 == 0 && deque.pop(value)) {
+            seen[value].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    while (deque.pop(value)) {
+        seen[value].fetch_add(1, std::memory_order_relaxed);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+    for (int i = 0; i < Count; ++i) {
+        EXPECT_EQ(seen[i].load(), 1) << i;
+    }
+}
+
+TEST(StealingSynCtx, CancelWhileTimerFires) {
+    // timers fire on the workers while this thread cancels them: exactly one of both resumes each delay,
+    // and the awaiter isn't touched after its coroutine resumed (run it under ASan/TSan)
+    static constexpr size_t Rounds = 500;
+    static constexpr size_t Batch = 32;
+    // declared before the context: the last delay of a round notifies after the wait saw the round complete
+    std::atomic<size_t> completed{0};
+    std::atomic<size_t> cancelled{0};
+    StealingSynCtx synCtx{4};
+    for (size_t round = 0; round < Rounds; ++round) {
+        std::array<CancellationSource, Batch> sources;
+        for (auto& source : sources) {
+            spawn(synCtx, [](StealingSynCtx& synCtx, CancellationToken token, std::atomic<size_t>& completed, std::atomic<size_t>& cancelled) -> Task<void> {
+                if (!co_await delay_for(0ms, synCtx, token)) {
+                    cancelled.fetch_add(1, std::memory_order_relaxed);
+                }
+                completed.fetch_add(1, std::memory_order_release);
+                completed.notify_all();
+            }(synCtx, source.token(), completed, cancelled));
+        }
+        for (auto& source : sources) {
+            source.request_cancel();
+        }
+        const auto expected = (round + 1) * Batch;
+        for (auto value = completed.load(std::memory_order_acquire); value != expected; value = completed.load(std::memory_order_acquire)) {
+            completed.wait(value);
+        }
+    }
+    Log::Info("CancelWhileTimerFires: cancelled={}/{}", cancelled.load(), Rounds * Batch);
+    EXPECT_EQ(completed.load(), Rounds * Batch);
+}
+
+TEST(StealingSynCtx, InboxDrainWakesIdleWorkers) {
+    // affinity posts all go to one worker's inbox: once drained into its deque the others must be woken to steal
+    static constexpr size_t Count = 32;
+    static constexpr size_t WorkerCount = 4;
+    std::vector<std::atomic<size_t>> ranOn(WorkerCount);
+    std::vector<Task<void>::Handle> handles;
+    std::atomic<size_t> remaining{Count}; // outlives the context: the last task notifies after the wait saw zero
+    {
+        StealingSynCtx synCtx{WorkerCount};
+        for (size_t i = 0; i < Count; ++i) {
+            handles.push_back([](StealingSynCtx& synCtx, std::vector<std::atomic<size_t>>& ranOn, std::atomic<size_t>& remaining) -> Task<void> {
+                ranOn[synCtx.current_worker().value_or(0)].fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::sleep_for(2ms); // blocking work keeps the worker busy
+                if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    remaining.notify_all();
+                }
+                co_return;
+            }(synCtx, ranOn, remaining).release());
+        }
+        std::this_thread::sleep_for(10ms); // let the workers park
+        for (auto handle : handles) {
+            synCtx.post(handle, 0);
+        }
+        for (auto value = remaining.load(); value != 0; value = remaining.load()) {
+            remaining.wait(value);
+        }
+    } // workers joined: the finished frames aren't touched anymore
+    for (auto handle : handles) {
+        handle.destroy();
+    }
+    const auto workersUsed = std::ranges::count_if(ranOn, [](const auto& count) { return count.load() > 0; });
+    EXPECT_GT(workersUsed, 1);
+}
@@ -0,0 +1,137 @@
+#include "CoroTimer.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    struct Fired {
+        std::vector<std::coroutine_handle<>> handles;
+        void operator()(TimerNode& node) { handles.push_back(node.handle); }
+    };
+
+    /// Distinct fake handles to identify nodes without real coroutines
+    std::coroutine_handle<> fake_handle(uintptr_t id) {
+        return std::coroutine_handle<>::from_address(reinterpret_cast<void*>(id * 16)); // NOLINT
+    }
+}
+
+TEST(TimerWheel, FiresInDeadlineOrder) {
+    const auto origin = TimerWheel::Clock::now();
+    TimerWheel wheel{origin};
+
+    std::vector<TimerNode> nodes(3);
+    const std::array delays = {30ms, 10ms, 20ms};
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodes[i].handle = fake_handle(i + 1);
+        wheel.schedule(nodes[i], origin + delays[i]);
+    }
+    EXPECT_EQ(wheel.size(), 3u);
+
+    Fired fired;
+    EXPECT_EQ(wheel.advance(origin + 9ms, fired), 0u);
+    EXPECT_EQ(wheel.advance(origin + 20ms, fired), 2u);
+    EXPECT_EQ(wheel.advance(origin + 30ms, fired), 1u);
+    ASSERT_EQ(fired.handles.size(), 3u);
+    EXPECT_EQ(fired.handles[0], fake_handle(2));
+    EXPECT_EQ(fired.handles[1], fake_handle(3));
+    EXPECT_EQ(fired.handles[2], fake_handle(1));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheel, CascadesAcrossLevels) {
+    const auto origin = TimerWheel::Clock::now();
+    TimerWheel wheel{origin};
+
+    // one delay per level plus beyond the wheel span
+    const std::array delays = {
+        std::chrono::milliseconds{5},
+        std::chrono::milliseconds{100},
+        std::chrono::milliseconds{5'000},
+        std::chrono::milliseconds{300'000},
+        std::chrono::milliseconds{TimerWheel::MaxSpan + 1'000},
+    };
+    std::vector<TimerNode> nodes(delays.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodes[i].handle = fake_handle(i + 1);
+        wheel.schedule(nodes[i], origin + delays[i]);
+    }
+
+    Fired fired;
+    for (size_t i = 0; i < delays.size(); ++i) {
+        EXPECT_EQ(wheel.advance(origin + delays[i] - 1ms, fired), 0u) << "early at " << i;
+        EXPECT_EQ(wheel.advance(origin + delays[i], fired), 1u) << "missed at " << i;
+        EXPECT_EQ(fired.handles.back(), fake_handle(i + 1));
+    }
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheel, CancelUnlinks) {
+    const auto origin = TimerWheel::Clock::now();
+    TimerWheel wheel{origin};
+
+    TimerNode kept{.handle = fake_handle(1)};
+    TimerNode cancelled{.handle = fake_handle(2)};
+    wheel.schedule(kept, origin + 10ms);
+    wheel.schedule(cancelled, origin + 10ms);
+
+    EXPECT_TRUE(wheel.cancel(cancelled));
+    EXPECT_FALSE(wheel.cancel(cancelled));
+    EXPECT_EQ(wheel.size(), 1u);
+
+    Fired fired;
+    EXPECT_EQ(wheel.advance(origin + 10ms, fired), 1u);
+    EXPECT_EQ(fired.handles.front(), fake_handle(1));
+    EXPECT_FALSE(wheel.cancel(kept));
+}
+
+TEST(TimerWheel, PastDeadlineFiresOnNextAdvance) {
+    const auto origin = TimerWheel::Clock::now();
+    TimerWheel wheel{origin};
+
+    Fired fired;
+    wheel.advance(origin + 50ms, fired);
+
+    TimerNode node{.handle = fake_handle(1)};
+    wheel.schedule(node, origin + 10ms);
+    EXPECT_EQ(wheel.next_deadline(), origin + 10ms);
+    EXPECT_EQ(wheel.advance(origin + 50ms, fired), 1u);
+}
+
+TEST(TimerWheel, FiresWithinDeadlineTick) {
+    const auto origin = TimerWheel::Clock::now();
+    TimerWheel wheel{origin};
+
+    const auto deadline = origin + 10ms + 300us;
+    TimerNode node{.handle = fake_handle(1)};
+    wheel.schedule(node, deadline);
+    EXPECT_EQ(wheel.next_deadline(), deadline);
+
+    Fired fired;
+    EXPECT_EQ(wheel.advance(deadline - 1us, fired), 0u);
+    EXPECT_EQ(wheel.next_deadline(), deadline);
+    EXPECT_EQ(wheel.advance(deadline, fired), 1u);
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheel, RepeatedDelaysAreNotLate) {
+    const auto origin = TimerWheel::Clock::now();
+    TimerWheel wheel{origin};
+
+    // a delay loop woken at next_deadline: each delay is rescheduled right after the previous fired,
+    // so deadlines drift across tick boundaries (the case where rounding them up made every delay a tick late)
+    auto now = origin + 250us;
+    TimerNode node{.handle = fake_handle(1)};
+    Fired fired;
+    for (int i = 0; i < 100; ++i) {
+        const auto deadline = now + 1ms + 10us;
+        wheel.schedule(node, deadline);
+        const auto wake = wheel.next_deadline();
+        ASSERT_TRUE(wake);
+        EXPECT_EQ(*wake - deadline, TimerWheel::Clock::duration::zero()) << "late at " << i;
+        EXPECT_EQ(wheel.advance(*wake - 1us, fired), 0u) << "early at " << i;
+        now = *wake;
+        ASSERT_EQ(wheel.advance(now, fired), 1u) << "missed at " << i;
+    }
+}
@@ -0,0 +1,93 @@
+#include "CoroTask.h"
+#include "CoroTest.h"
+#include "CoroWhen.h"
+#include <stdexcept>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    Task<int> delayed_value(QueueSynCtx& synCtx, std::chrono::milliseconds delay, int value) {
+        co_await delay_for(delay, synCtx);
+        co_return value;
+    }
+
+    Task<void> delayed_throw(QueueSynCtx& synCtx) {
+        co_await delay_for(1ms, synCtx);
+        throw std::runtime_error("child failure");
+    }
+}
+
+TEST_F(CoroTest, WhenAllCollectsResults) {
+    const auto started = std::chrono::steady_clock::now();
+    auto [a, b, c] = co_await when_all(
+        delayed_value(synCtx, 30ms, 1),
+        delayed_value(synCtx, 10ms, 2),
+        delay_for(20ms, synCtx));
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, 2);
+    EXPECT_TRUE(c); // delay elapsed
+    EXPECT_GE(elapsed, 30ms);
+    EXPECT_LT(elapsed, 60ms); // concurrent, not sequential
+}
+
+TEST_F(CoroTest, WhenAllRethrows) {
+    bool thrown = false;
+    try {
+        co_await when_all(delayed_value(synCtx, 5ms, 1), delayed_throw(synCtx));
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+}
+
+TEST_F(CoroTest, WhenAnyCancelsLosers) {
+    CancellationSource source;
+    const auto started = std::chrono::steady_clock::now();
+    auto result = co_await when_any(source,
+        delay_for(10s, synCtx, source.token()),
+        delayed_value(synCtx, 10ms, 42));
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+
+    EXPECT_EQ(result.index(), 1u);
+    if (result.index() == 1) {
+        EXPECT_EQ(std::get<1>(result), 42);
+    }
+    EXPECT_TRUE(source.is_cancellation_requested());
+    EXPECT_LT(elapsed, 1s);
+    EXPECT_TRUE(synCtx.get_timers().empty()); // cancelled delay was removed, not left sleeping
+}
+
+TEST_F(CoroTest, CancelledDelayResumesEarly) {
+    CancellationSource source;
+    spawn(synCtx, [](QueueSynCtx& synCtx, CancellationSource& source) -> Task<void> {
+        co_await delay_for(5ms, synCtx);
+        source.request_cancel();
+    }(synCtx, source));
+
+    const auto elapsed = co_await delay_for(10s, synCtx, source.token());
+    EXPECT_FALSE(elapsed);
+    EXPECT_TRUE(synCtx.get_timers().empty());
+
+    // already cancelled token completes without suspending
+    EXPECT_FALSE(co_await delay_for(10s, synCtx, source.token()));
+}
+
+TEST(Cancellation, RegistrationUnlinks) {
+    CancellationSource source;
+    int calls = 0;
+    auto increment = [](void* context) { ++*static_cast<int*>(context); };
+    {
+        CancellationRegistration dropped;
+        EXPECT_TRUE(dropped.register_callback(source.token(), increment, &calls));
+    }
+    CancellationRegistration kept;
+    EXPECT_TRUE(kept.register_callback(source.token(), increment, &calls));
+
+    EXPECT_TRUE(source.request_cancel());
+    EXPECT_FALSE(source.request_cancel());
+    EXPECT_EQ(calls, 1);
+    EXPECT_FALSE(kept.register_callback(source.token(), increment, &calls));
+}
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+"""Fail when the steady-state frame loop of harness reports allocates.
+
+Usage: check_allocations.py <report-dir-or-json> [--max-allocations 0]
+
+Reads the "allocations" section of frame harness JSON reports (apps linking //pkg/sdl:alloc_hooks, frames after
+TX_HARNESS_WARMUP). Exit code is 1 when any report allocated more than the limit after warmup or wasn't hooked,
+or when there are no reports at all, so it can gate CI jobs (frame_harness.sh runs it).
+"""
+
+import argparse
+import json
+import sys
+from pathlib import Path
+
+
+def load_reports(path: Path) -> dict[str, dict]:
+    files = sorted(path.glob("*.json")) if path.is_dir() else [path] if path.exists() else []
+    return {file.name: json.loads(file.read_text()) for file in files}
+
+
+def check(name: str, report: dict, max_allocations: int) -> bool:
+    allocations = report.get("allocations")
+    if not allocations or not allocations.get("hooked"):
+        print(f"== {name}: no allocation counters (app doesn't link //pkg/sdl:alloc_hooks w/ --config=harness) FAILED")
+        return False
+    steady = allocations["steady_allocations"]
+    passed = steady <= max_allocations
+    print(
+        f"== {name}: {steady} allocations ({allocations['steady_bytes']} bytes) in "
+        f"{allocations['allocating_frames']}/{allocations['steady_frames']} steady frames, "
+        f"max {allocations['max_frame_allocations']}/frame{'' if passed else ' FAILED'}"
+    )
+    return passed
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("reports", type=Path)
+    parser.add_argument("--max-allocations", type=int, default=0, help="allowed steady state allocations per report")
+    args = parser.parse_args()
+
+    reports = load_reports(args.reports)
+    if not reports:
+        print(f"no reports in {args.reports} FAILED")
+        return 1
+    failures = sum(not check(name, report, args.max_allocations) for name, report in reports.items())
+    print(f"{failures} of {len(reports)} report(s) failed")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Compare frame harness JSON reports against a baseline and flag regressions.
+
+Usage: compare_frames.py <baseline-dir-or-json> <current-dir-or-json> [--threshold 0.10] [--metrics p50_ms,p95_ms,p99_ms]
+
+Reports are matched by file name when directories are given. Exit code is 1 when any phase metric
+of any report grew by more than the threshold (relative), so it can gate CI jobs.
+"""
+
+import argparse
+import json
+import sys
+from pathlib import Path
+
+# differences below this are timer noise, not regressions
+MIN_ABSOLUTE_MS = 0.05
+
+
+def load_reports(path: Path) -> dict[str, dict]:
+    files = sorted(path.glob("*.json")) if path.is_dir() else [path]
+    return {file.name: json.loads(file.read_text()) for file in files}
+
+
+def compare(name: str, baseline: dict, current: dict, metrics: list[str], threshold: float) -> int:
+    regressions = 0
+    print(f"== {name}: {baseline.get('frames')} -> {current.get('frames')} frames")
+    for phase, base_values in baseline["phases"].items():
+        current_values = current["phases"].get(phase)
+        if current_values is None:
+            print(f"  {phase:<14} missing in current report")
+            continue
+        for metric in metrics:
+            before = base_values.get(metric, 0.0)
+            after = current_values.get(metric, 0.0)
+            delta = after - before
+            relative = delta / before if before > 0 else 0.0
+            regressed = relative > threshold and delta > MIN_ABSOLUTE_MS
+            regressions += regressed
+            mark = "REGRESSION" if regressed else ""
+            print(f"  {phase:<14} {metric:<7} {before:9.3f} -> {after:9.3f} ms ({relative:+7.1%}) {mark}")
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", type=Path)
+    parser.add_argument("current", type=Path)
+    parser.add_argument("--threshold", type=float, default=0.10, help="relative growth treated as regression")
+    parser.add_argument("--metrics", default="p50_ms,p95_ms,p99_ms", help="comma separated phase metrics")
+    args = parser.parse_args()
+
+    baselines = load_reports(args.baseline)
+    currents = load_reports(args.current)
+    if args.baseline.is_file() and args.current.is_file():
+        currents = {args.baseline.name: next(iter(currents.values()))}
+
+    metrics = args.metrics.split(",")
+    regressions = 0
+    for name, baseline in baselines.items():
+        if name not in currents:
+            print(f"== {name}: missing in current reports")
+            continue
+        regressions += compare(name, baseline, currents[name], metrics, args.threshold)
+
+    print(f"{regressions} regression(s) over {args.threshold:.0%}")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
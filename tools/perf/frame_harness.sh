@@ -0,0 +1,33 @@
+#!/usr/bin/env bash
+# Run demo apps in harness mode (headless, fixed clock, fixed frame count) and collect frame time reports.
+# Usage: tools/perf/frame_harness.sh [out-dir] [frames] [bazel args...]
+#   TX_HARNESS_INPUT=<file> can be set to replay scripted input (see pkg/sdl/Sdl/Loop/InputReplay.h)
+#   REPORT_FORMAT=csv writes per-frame timings instead of the percentiles summary
+#   JSON reports are gated on steady state allocations (check_allocations.py), CHECK_ALLOCATIONS=0 skips it
+set -euo pipefail
+
+cd "$(dirname "$0")/../.."
+OUT_DIR="$(realpath -m "${1:-_perf/frames}")"
+FRAMES="${2:-600}"
+shift $(( $# > 2 ? 2 : $# ))
+
+TARGETS=(
+    //demo/pkg/sdl
+    //demo/pkg/im
+)
+
+mkdir -p "$OUT_DIR"
+for target in "${TARGETS[@]}"; do
+    name="$(basename "$target")"
+    echo "==== $target ($FRAMES frames) -> $OUT_DIR/$name.json"
+    TX_HARNESS_FRAMES="$FRAMES" \
+    TX_HARNESS_FIXED_DT="${TX_HARNESS_FIXED_DT:-0.016666667}" \
+    TX_HARNESS_HEADLESS="${TX_HARNESS_HEADLESS:-1}" \
+    TX_HARNESS_NAME="$name" \
+    TX_HARNESS_REPORT="$OUT_DIR/$name.${REPORT_FORMAT:-json}" \
+        bazel run -c opt --config=harness "$@" "$target" -- 0
+done
+
+if [[ "${REPORT_FORMAT:-json}" == json && "${CHECK_ALLOCATIONS:-1}" != 0 ]]; then
+    tools/perf/check_allocations.py "$OUT_DIR"
+fi
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Time-to-first-frame benchmark: launch demo apps N times headless and report median startup marks.
+
+Usage: startup_bench.py [--runs 10] [--out _perf/startup] [--windowed] [target ...] [-- bazel args]
+
+Each app is built once with `bazel run --script_path` (so launches don't include bazel itself) and then
+started in the instrumented launch mode of Sdl::Stats::StartupTrace: it quits right after the first present
+and appends its marks (ms since launch) to <out>/<name>.jsonl. A summary with medians goes to <out>/summary.json.
+"""
+
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+DEFAULT_TARGETS = [
+    "//demo/pkg/sdl",
+    "//demo/pkg/im",
+    "//demo/try/sdl3-1",
+    "//demo/try/sdl3-2",
+    "//demo/try/imgui-1",
+]
+MARKS = ["process_start", "boot_init", "sdl_init", "window", "renderer", "handler_start", "first_present", "exit"]
+LAUNCH_TIMEOUT_SECONDS = 60
+
+
+def build_launcher(target: str, out: Path, bazel_args: list[str]) -> Path:
+    script = out / f"run_{target.rsplit('/', 1)[-1]}.sh"
+    subprocess.run(["bazel", "run", "-c", "opt", f"--script_path={script}", *bazel_args, target], check=True)
+    return script
+
+
+def launch(script: Path, report: Path, windowed: bool) -> float:
+    env = dict(os.environ)
+    env["TX_STARTUP_REPORT"] = str(report)
+    if not windowed:
+        env["SDL_VIDEO_DRIVER"] = "offscreen"
+        env["SDL_RENDER_DRIVER"] = "software"
+    started = time.monotonic()
+    env["TX_STARTUP_LAUNCH_NS"] = str(time.time_ns())
+    subprocess.run([str(script)], env=env, check=True, timeout=LAUNCH_TIMEOUT_SECONDS,
+                   stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return (time.monotonic() - started) * 1000.0
+
+
+def summarize(report: Path, wall_ms: list[float]) -> dict:
+    lines = [json.loads(line) for line in report.read_text().splitlines() if line.strip()]
+    medians = {}
+    for mark in MARKS:
+        values = [line["ms"][mark] for line in lines if mark in line["ms"]]
+        if values:
+            medians[mark] = statistics.median(values)
+    return {"runs": len(lines), "median_ms": medians, "wall_median_ms": statistics.median(wall_ms) if wall_ms else None}
+
+
+def main() -> int:
+    argv = sys.argv[1:]
+    bazel_args = argv[argv.index("--") + 1:] if "--" in argv else []
+    argv = argv[:argv.index("--")] if "--" in argv else argv
+
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("targets", nargs="*", default=DEFAULT_TARGETS)
+    parser.add_argument("--runs", type=int, default=10)
+    parser.add_argument("--out", type=Path, default=Path("_perf/startup"))
+    parser.add_argument("--windowed", action="store_true", help="use the default video driver instead of offscreen")
+    args = parser.parse_args(argv)
+
+    os.chdir(Path(__file__).resolve().parents[2])
+    out = args.out.resolve()
+    out.mkdir(parents=True, exist_ok=True)
+
+    summary = {}
+    for target in args.targets:
+        name = target.rsplit("/", 1)[-1]
+        script = build_launcher(target, out, bazel_args)
+        report = out / f"{name}.jsonl"
+        report.unlink(missing_ok=True)
+        wall_ms = []
+        for run in range(args.runs):
+            try:
+                wall_ms.append(launch(script, report, args.windowed))
+            except (subprocess.CalledProcessError, subprocess.TimeoutExpired) as error:
+                print(f"{target}: run {run} failed: {error}", file=sys.stderr)
+        if not report.exists():
+            print(f"{target}: no startup report", file=sys.stderr)
+            continue
+        summary[name] = summarize(report, wall_ms)
+
+    (out / "summary.json").write_text(json.dumps(summary, indent=2) + "\n")
+
+    print(f"{'app':<10} {'runs':>4} " + " ".join(f"{mark:>13}" for mark in MARKS) + f" {'wall':>9}")
+    for name, result in summary.items():
+        medians = result["median_ms"]
+        cells = " ".join(f"{medians[mark]:13.1f}" if mark in medians else f"{'-':>13}" for mark in MARKS)
+        print(f"{name:<10} {result['runs']:>4} {cells} {result['wall_median_ms'] or 0:9.1f}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())